@@ -0,0 +1,477 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <unistd.h>
+#include "checkpoint.h"
+#include "scheduler_state.h"
+#include "result_cache.h"
+
+#define CHECKPOINT_MAGIC "PSCK"
+#define CHECKPOINT_FORMAT_VERSION 6
+
+// Parte fixa do snapshot; seguem-se os vetores de tamanho variável
+typedef struct {
+    int type;
+    int quantum;
+    int aging_interval;
+    int count;
+    unsigned long long fingerprint;    // Carga de trabalho, na ordem do estado
+
+    SimTime current_time;
+    int completed;
+    int next_arrival;
+    int first_alive;
+    int head;
+    int tail;
+    int cursor;
+    int prev;
+    int last_run;
+    int bucket_count;
+    int active_count;
+    int ready_size;
+    int expiry_size;
+    int use_heap;
+    long long context_switches;
+    long long total_waiting;
+    long long total_turnaround;
+} SnapshotHeader;
+
+// Resultados de um processo já produzidos pela simulação
+typedef struct {
+    SimTime completion_time;
+    SimTime first_run_time;
+    SimTime remaining_time;
+    int pid;
+    int deadline_miss_count;
+    int missed_deadline;
+} SnapshotProcess;
+
+// Os campos são gravados um a um com largura fixa (int32 e int64 na ordem
+// de bytes da máquina), como na cache em disco: o ficheiro não depende do
+// enchimento das estruturas nem leva bytes por inicializar
+static bool put_i32(FILE* output, int value) {
+    int32_t v = value;
+    return fwrite(&v, sizeof(v), 1, output) == 1;
+}
+
+static bool put_i64(FILE* output, long long value) {
+    int64_t v = value;
+    return fwrite(&v, sizeof(v), 1, output) == 1;
+}
+
+static bool get_i32(FILE* input, int* value) {
+    int32_t v;
+    if (fread(&v, sizeof(v), 1, input) != 1) return false;
+    *value = v;
+    return true;
+}
+
+static bool get_i64(FILE* input, long long* value) {
+    int64_t v;
+    if (fread(&v, sizeof(v), 1, input) != 1) return false;
+    *value = v;
+    return true;
+}
+
+static bool write_header(FILE* output, const SnapshotHeader* h) {
+    return put_i32(output, h->type) && put_i32(output, h->quantum) &&
+           put_i32(output, h->aging_interval) && put_i32(output, h->count) &&
+           put_i64(output, (long long)h->fingerprint) && put_i64(output, h->current_time) &&
+           put_i32(output, h->completed) && put_i32(output, h->next_arrival) &&
+           put_i32(output, h->first_alive) && put_i32(output, h->head) &&
+           put_i32(output, h->tail) && put_i32(output, h->cursor) &&
+           put_i32(output, h->prev) && put_i32(output, h->last_run) &&
+           put_i32(output, h->bucket_count) && put_i32(output, h->active_count) &&
+           put_i32(output, h->ready_size) && put_i32(output, h->expiry_size) &&
+           put_i32(output, h->use_heap) && put_i64(output, h->context_switches) &&
+           put_i64(output, h->total_waiting) && put_i64(output, h->total_turnaround);
+}
+
+static bool read_header(FILE* input, SnapshotHeader* h) {
+    long long fingerprint;
+    bool ok = get_i32(input, &h->type) && get_i32(input, &h->quantum) &&
+              get_i32(input, &h->aging_interval) && get_i32(input, &h->count) &&
+              get_i64(input, &fingerprint) && get_i64(input, &h->current_time) &&
+              get_i32(input, &h->completed) && get_i32(input, &h->next_arrival) &&
+              get_i32(input, &h->first_alive) && get_i32(input, &h->head) &&
+              get_i32(input, &h->tail) && get_i32(input, &h->cursor) &&
+              get_i32(input, &h->prev) && get_i32(input, &h->last_run) &&
+              get_i32(input, &h->bucket_count) && get_i32(input, &h->active_count) &&
+              get_i32(input, &h->ready_size) && get_i32(input, &h->expiry_size) &&
+              get_i32(input, &h->use_heap) && get_i64(input, &h->context_switches) &&
+              get_i64(input, &h->total_waiting) && get_i64(input, &h->total_turnaround);
+    h->fingerprint = (unsigned long long)fingerprint;
+    return ok;
+}
+
+static bool write_process(FILE* output, const SnapshotProcess* r) {
+    return put_i64(output, r->completion_time) && put_i64(output, r->first_run_time) &&
+           put_i64(output, r->remaining_time) && put_i32(output, r->pid) &&
+           put_i32(output, r->deadline_miss_count) && put_i32(output, r->missed_deadline);
+}
+
+static bool read_process(FILE* input, SnapshotProcess* r) {
+    return get_i64(input, &r->completion_time) && get_i64(input, &r->first_run_time) &&
+           get_i64(input, &r->remaining_time) && get_i32(input, &r->pid) &&
+           get_i32(input, &r->deadline_miss_count) && get_i32(input, &r->missed_deadline);
+}
+
+static bool write_ints(FILE* output, const int* values, int count) {
+    for (int k = 0; values != NULL && k < count; k++) {
+        if (!put_i32(output, values[k])) return false;
+    }
+    return true;
+}
+
+static bool read_ints(FILE* input, int* values, int count) {
+    for (int k = 0; values != NULL && k < count; k++) {
+        if (!get_i32(input, &values[k])) return false;
+    }
+    return true;
+}
+
+static bool write_times(FILE* output, const SimTime* values, int count) {
+    for (int k = 0; values != NULL && k < count; k++) {
+        if (!put_i64(output, values[k])) return false;
+    }
+    return true;
+}
+
+static bool read_times(FILE* input, SimTime* values, int count) {
+    for (int k = 0; values != NULL && k < count; k++) {
+        if (!get_i64(input, &values[k])) return false;
+    }
+    return true;
+}
+
+static bool write_heap(FILE* output, const Heap* heap) {
+    for (int n = 0; n < heap->size; n++) {
+        if (!put_i64(output, heap->nodes[n].key) || !put_i32(output, heap->nodes[n].index)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Posição de processo válida (com allow_none, também -1 = nenhum)
+static inline bool valid_index(int index, int count, bool allow_none) {
+    return (allow_none && index == -1) || (index >= 0 && index < count);
+}
+
+static bool valid_indices(const int* values, int length, int count) {
+    for (int k = 0; values != NULL && k < length; k++) {
+        if (!valid_index(values[k], count, true)) return false;
+    }
+    return true;
+}
+
+static bool read_heap(FILE* input, Heap* heap, int size, int count) {
+    if (size == 0) {
+        if (heap->nodes != NULL) heap->size = 0;
+        return true;
+    }
+    // Um heap que o algoritmo não usa não pode ter entradas
+    if (heap->nodes == NULL || size < 0 || size > 2 * count + 16) return false;
+    if (size > heap->capacity) {
+        heap_free(heap);
+        heap_init(heap, size);
+    }
+    heap->size = size;
+    for (int n = 0; n < size; n++) {
+        if (!get_i64(input, &heap->nodes[n].key) || !get_i32(input, &heap->nodes[n].index) ||
+            !valid_index(heap->nodes[n].index, count, false)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Os índices do cabeçalho são usados diretamente nos vetores do estado
+static bool valid_header(const SnapshotHeader* h) {
+    int count = h->count;
+    return h->completed >= 0 && h->completed <= count &&
+           h->next_arrival >= 0 && h->next_arrival <= count &&
+           h->first_alive >= 0 && h->first_alive <= count &&
+           valid_index(h->head, count, true) && valid_index(h->tail, count, true) &&
+           valid_index(h->cursor, count, true) && valid_index(h->prev, count, true) &&
+           valid_index(h->last_run, count, true) &&
+           h->bucket_count >= 0 && h->active_count >= 0 && h->active_count <= h->bucket_count &&
+           h->ready_size >= 0 && h->expiry_size >= 0;
+}
+
+// Índices dentro dos limites não bastam: um estado incoerente (por
+// exemplo um processo por terminar que não está em nenhuma fila) leva o
+// passo do algoritmo a procurar a chegada seguinte depois do fim do vetor.
+// Verifica-se o que cada política assume sobre o seu estado.
+static bool consistent_state(const SchedulerState* s) {
+    if (s->type == FCFS || s->type == HRRN || s->type == RATE_MONOTONIC) return true;
+
+    // Terminados (ou descartados) são exatamente os de tempo restante nulo
+    int finished = 0;
+    for (int i = 0; i < s->count; i++) {
+        if (s->remaining[i] <= 0) finished++;
+    }
+    if (finished != s->completed) return false;
+
+    bool* queued = (bool*)calloc(s->count > 0 ? s->count : 1, sizeof(bool));
+    if (queued == NULL) {
+        perror("Erro ao alocar memória para o snapshot");
+        exit(EXIT_FAILURE);
+    }
+    bool ok = true;
+    if (s->type == ROUND_ROBIN) {
+        // Lista de prontos sem ciclos, a terminar em 'tail', com o cursor e
+        // o seu antecessor dentro dela
+        int steps = 0, last = -1;
+        for (int i = s->head; ok && i != -1; i = s->next[i]) {
+            ok = ++steps <= s->count && !queued[i];
+            queued[i] = true;
+            last = i;
+        }
+        ok = ok && last == s->tail &&
+             (s->cursor == -1 || queued[s->cursor]) &&
+             (s->prev == -1 ? s->cursor == -1 || s->cursor == s->head
+                            : queued[s->prev] && s->next[s->prev] == s->cursor);
+    } else if ((s->type == SJF || s->type == EDF) && !s->use_heap) {
+        // Varrimento: antes da janela já não há processos por terminar
+        ok = s->first_alive <= s->next_arrival;
+        for (int i = 0; ok && i < s->first_alive; i++) {
+            ok = s->remaining[i] <= 0;
+        }
+        for (int i = s->first_alive; i < s->next_arrival; i++) queued[i] = true;
+    } else {
+        for (int n = 0; n < s->ready.size; n++) queued[s->ready.nodes[n].index] = true;
+    }
+
+    // Todos os já admitidos e por terminar estão na fila de prontos
+    for (int i = 0; ok && i < s->next_arrival; i++) {
+        ok = s->remaining[i] <= 0 || queued[i];
+    }
+    free(queued);
+    return ok;
+}
+
+bool checkpoint_save(const SchedulerState* state, Process** processes, FILE* output) {
+    int count = state->count;
+    SnapshotHeader header;
+    header.type = state->type;
+    header.quantum = state->quantum;
+    header.aging_interval = state->aging_interval;
+    header.count = count;
+    header.fingerprint = workload_fingerprint(processes, count);
+    header.current_time = state->current_time;
+    header.completed = state->completed;
+    header.next_arrival = state->next_arrival;
+    header.first_alive = state->first_alive;
+    header.head = state->head;
+    header.tail = state->tail;
+    header.cursor = state->cursor;
+    header.prev = state->prev;
+    header.last_run = state->last_run;
+    header.bucket_count = state->bucket_count;
+    header.active_count = state->active_count;
+    header.ready_size = state->ready.size;
+    header.expiry_size = state->expiry.size;
+    header.use_heap = state->use_heap;
+    header.context_switches = state->context_switches;
+    header.total_waiting = state->total_waiting;
+    header.total_turnaround = state->total_turnaround;
+
+    bool ok = fwrite(CHECKPOINT_MAGIC, 1, 4, output) == 4 &&
+              put_i32(output, CHECKPOINT_FORMAT_VERSION) &&
+              write_header(output, &header);
+    for (int i = 0; ok && i < count; i++) {
+        const Process* p = processes[i];
+        SnapshotProcess record = { p->completion_time, p->first_run_time, p->remaining_time,
+                                   p->pid, p->deadline_miss_count, p->missed_deadline };
+        ok = write_process(output, &record);
+    }
+    return ok &&
+           write_times(output, state->remaining, count) &&
+           write_ints(output, state->next, count) &&
+           write_times(output, state->release, count) &&
+           write_heap(output, &state->ready) &&
+           write_heap(output, &state->expiry) &&
+           write_ints(output, state->bucket_head, state->bucket_count) &&
+           write_ints(output, state->active, state->active_count);
+}
+
+// Sufixo dos ficheiros temporários, único dentro do processo
+static atomic_uint temp_serial;
+
+bool checkpoint_save_file(const SchedulerState* state, Process** processes, const char* path) {
+    // Cada gravação tem o seu temporário (pid + contador): duas gravações
+    // para o mesmo caminho não se truncam uma à outra
+    char temp[4200];
+    snprintf(temp, sizeof(temp), "%s.%ld.%u.tmp", path, (long)getpid(),
+             atomic_fetch_add(&temp_serial, 1));
+
+    FILE* file = fopen(temp, "wb");
+    if (file == NULL) return false;
+    bool ok = checkpoint_save(state, processes, file);
+    ok = fclose(file) == 0 && ok;
+
+    // Escreve num ficheiro temporário e renomeia para nunca deixar snapshots parciais
+    if (ok) {
+        ok = rename(temp, path) == 0;
+    } else {
+        remove(temp);
+    }
+    return ok;
+}
+
+static int compare_pid(const void* a, const void* b) {
+    int x = (*(Process* const*)a)->pid;
+    int y = (*(Process* const*)b)->pid;
+    return (x > y) - (x < y);
+}
+
+// Põe 'processes' na ordem guardada (identificada pelos pids)
+static bool restore_order(Process** processes, int count, const SnapshotProcess* results) {
+    Process** by_pid = (Process**)malloc((count > 0 ? count : 1) * sizeof(Process*));
+    if (by_pid == NULL) {
+        perror("Erro ao alocar memória para o snapshot");
+        exit(EXIT_FAILURE);
+    }
+    memcpy(by_pid, processes, count * sizeof(Process*));
+    qsort(by_pid, count, sizeof(Process*), compare_pid);
+
+    // Cada processo só pode aparecer uma vez (pids repetidos num ficheiro
+    // corrompido deixariam o vetor com ponteiros duplicados)
+    bool* used = (bool*)calloc(count > 0 ? count : 1, sizeof(bool));
+    if (used == NULL) {
+        perror("Erro ao alocar memória para o snapshot");
+        exit(EXIT_FAILURE);
+    }
+
+    bool ok = true;
+    for (int i = 0; i < count && ok; i++) {
+        Process key;
+        Process* key_pointer = &key;
+        key.pid = results[i].pid;
+        Process** found = (Process**)bsearch(&key_pointer, by_pid, count, sizeof(Process*), compare_pid);
+        if (found == NULL || used[found - by_pid]) {
+            ok = false;
+            break;
+        }
+        used[found - by_pid] = true;
+        processes[i] = *found;
+    }
+    if (!ok) {
+        // Carga diferente: repõe a ordem recebida (ordenada por pid)
+        memcpy(processes, by_pid, count * sizeof(Process*));
+    }
+    free(used);
+    free(by_pid);
+    return ok;
+}
+
+SchedulerState* checkpoint_load(FILE* input, Process** processes, int count) {
+    char magic[4];
+    int version;
+    SnapshotHeader header;
+    if (fread(magic, 1, 4, input) != 4 || memcmp(magic, CHECKPOINT_MAGIC, 4) != 0 ||
+        !get_i32(input, &version) || version != CHECKPOINT_FORMAT_VERSION ||
+        !read_header(input, &header) ||
+        header.count != count || header.type < FCFS || header.type > HRRN ||
+        !valid_header(&header)) {
+        return NULL;
+    }
+
+    SnapshotProcess* results = (SnapshotProcess*)malloc((count > 0 ? count : 1) * sizeof(SnapshotProcess));
+    if (results == NULL) {
+        perror("Erro ao alocar memória para o snapshot");
+        exit(EXIT_FAILURE);
+    }
+    bool complete = true;
+    for (int i = 0; complete && i < count; i++) {
+        complete = read_process(input, &results[i]);
+    }
+    if (!complete || !restore_order(processes, count, results) ||
+        workload_fingerprint(processes, count) != header.fingerprint) {
+        free(results);
+        return NULL;
+    }
+
+    // As partes derivadas da carga são reconstruídas; o resto vem do ficheiro
+    SchedulerState* state = scheduler_state_create(processes, count, (SchedulerType)header.type,
+                                                   header.quantum, header.aging_interval);
+    bool ok = header.bucket_count == state->bucket_count &&
+              read_times(input, state->remaining, count) &&
+              read_ints(input, state->next, count) &&
+              valid_indices(state->next, count, count) &&
+              read_times(input, state->release, count) &&
+              read_heap(input, &state->ready, header.ready_size, count) &&
+              read_heap(input, &state->expiry, header.expiry_size, count) &&
+              read_ints(input, state->bucket_head, state->bucket_count) &&
+              valid_indices(state->bucket_head, state->bucket_count, count) &&
+              read_ints(input, state->active, header.active_count);
+
+    // A marca de grupo ativo resulta da lista de ativos guardada
+    for (int b = 0; ok && b < state->bucket_count; b++) {
+        state->bucket_listed[b] = 0;
+    }
+    for (int k = 0; ok && k < header.active_count; k++) {
+        int b = state->active[k];
+        if (b < 0 || b >= state->bucket_count || state->bucket_listed[b]) {
+            ok = false;
+        } else {
+            state->bucket_listed[b] = 1;
+        }
+    }
+    if (!ok) {
+        scheduler_state_free(state);
+        free(results);
+        return NULL;
+    }
+
+    state->current_time = header.current_time;
+    state->completed = header.completed;
+    state->next_arrival = header.next_arrival;
+    state->first_alive = header.first_alive;
+    state->use_heap = header.use_heap != 0;
+    state->head = header.head;
+    state->tail = header.tail;
+    state->cursor = header.cursor;
+    state->prev = header.prev;
+    state->last_run = header.last_run;
+    state->active_count = header.active_count;
+    state->context_switches = header.context_switches;
+    state->total_waiting = header.total_waiting;
+    state->total_turnaround = header.total_turnaround;
+    if (!consistent_state(state)) {
+        scheduler_state_free(state);
+        free(results);
+        return NULL;
+    }
+
+    for (int i = 0; i < count; i++) {
+        Process* p = processes[i];
+        p->completion_time = results[i].completion_time;
+        p->first_run_time = results[i].first_run_time;
+        p->remaining_time = results[i].remaining_time;
+        p->deadline_miss_count = results[i].deadline_miss_count;
+        p->missed_deadline = results[i].missed_deadline != 0;
+    }
+    free(results);
+    return state;
+}
+
+SchedulerState* checkpoint_load_file(const char* path, Process** processes, int count) {
+    FILE* file = fopen(path, "rb");
+    if (file == NULL) return NULL;
+    SchedulerState* state = checkpoint_load(file, processes, count);
+    fclose(file);
+    return state;
+}
+
+SchedulerState* checkpoint_fork(const SchedulerState* state, Process** processes, Process** branch) {
+    for (int i = 0; i < state->count; i++) {
+        branch[i] = clone_process(processes[i]);
+    }
+    return scheduler_state_clone(state);
+}
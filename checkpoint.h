@@ -0,0 +1,34 @@
+// ----------------------------------------------------------------
+//          Snapshots de simulações em curso (checkpoint/restauro)
+
+//   Um snapshot guarda o relógio, as estruturas de prontos, os tempos
+//   restantes, os acumuladores e os resultados por processo já
+//   produzidos. A carga de trabalho não é guardada, só a sua impressão
+//   digital: ao restaurar é preciso fornecer os mesmos processos, e a
+//   simulação continua exatamente como teria continuado sem pausa.
+//   O formato é binário, na ordem de bytes da máquina.
+// ----------------------------------------------------------------
+
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+#include <stdio.h>
+#include <stdbool.h>
+#include "process.h"
+#include "scheduler.h"
+
+// 'processes' é o vetor usado com o estado (na ordem deixada por scheduler_begin)
+bool checkpoint_save(const SchedulerState* state, Process** processes, FILE* output);
+bool checkpoint_save_file(const SchedulerState* state, Process** processes, const char* path);
+
+// Restaura um snapshot sobre a mesma carga de trabalho, em qualquer ordem:
+// o vetor é reordenado como estava e os resultados por processo são repostos.
+// Devolve NULL se o ficheiro for inválido ou a carga não corresponder.
+SchedulerState* checkpoint_load(FILE* input, Process** processes, int count);
+SchedulerState* checkpoint_load_file(const char* path, Process** processes, int count);
+
+// Ramo hipotético a partir de um prefixo comum: copia os processos para
+// 'branch' (mesma ordem) e devolve um estado independente do original
+SchedulerState* checkpoint_fork(const SchedulerState* state, Process** processes, Process** branch);
+
+#endif
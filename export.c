@@ -0,0 +1,218 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "export.h"
+#include "output.h"
+
+#define COLUMN_MAGIC "PSCOLS\0\0"
+#define COLUMN_BYTE_ORDER 0x01020304u
+#define COLUMN_NAME_SIZE 24
+
+enum {
+    COLUMN_INT32 = 1,
+    COLUMN_UINT8 = 2,
+    COLUMN_FLOAT64 = 3,
+    COLUMN_INT64 = 4
+};
+
+// Colunas, pela ordem em que são escritas
+enum {
+    COL_PID,
+    COL_ARRIVAL,
+    COL_BURST,
+    COL_PRIORITY,
+    COL_FIRST_RUN,
+    COL_COMPLETION,
+    COL_DEADLINE,
+    COL_MISSED,
+    COL_DROPPED,
+    COL_MISS_COUNT,
+    COLUMN_COUNT
+};
+
+static const struct {
+    const char* name;
+    uint32_t type;
+} columns[COLUMN_COUNT] = {
+    { "pid", COLUMN_INT32 },
+    { "arrival", COLUMN_INT64 },
+    { "burst", COLUMN_INT64 },
+    { "priority", COLUMN_INT32 },
+    { "first_run", COLUMN_INT64 },
+    { "completion", COLUMN_INT64 },
+    { "deadline", COLUMN_INT64 },
+    { "missed_deadline", COLUMN_UINT8 },
+    { "dropped", COLUMN_UINT8 },
+    { "deadline_miss_count", COLUMN_INT32 }
+};
+
+static size_t column_width(uint32_t type) {
+    return type == COLUMN_INT64 ? sizeof(int64_t) : type == COLUMN_INT32 ? sizeof(int32_t) : 1;
+}
+
+struct ColumnWriter {
+    OutputBuffer out;
+    char path[4096];
+    char temp[4200];
+    char* data[COLUMN_COUNT];  // Valores do bloco em curso, coluna a coluna
+    int rows;                  // Linhas do bloco em curso
+};
+
+static void write_u32(OutputBuffer* out, uint32_t value) {
+    output_bytes(out, (const char*)&value, sizeof(value));
+}
+
+static void write_name(OutputBuffer* out, const char* name) {
+    char field[COLUMN_NAME_SIZE];
+    memset(field, 0, sizeof(field));
+    strncpy(field, name, sizeof(field) - 1);
+    output_bytes(out, field, sizeof(field));
+}
+
+ColumnWriter* column_writer_open(const char* path) {
+    ColumnWriter* writer = (ColumnWriter*)calloc(1, sizeof(ColumnWriter));
+    if (writer == NULL) {
+        perror("Erro ao alocar memória para a exportação");
+        exit(EXIT_FAILURE);
+    }
+    snprintf(writer->path, sizeof(writer->path), "%s", path);
+    snprintf(writer->temp, sizeof(writer->temp), "%s.tmp", path);
+
+    int fd = open(writer->temp, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        free(writer);
+        return NULL;
+    }
+    for (int c = 0; c < COLUMN_COUNT; c++) {
+        writer->data[c] = (char*)malloc(COLUMN_CHUNK_ROWS * column_width(columns[c].type));
+        if (writer->data[c] == NULL) {
+            perror("Erro ao alocar memória para a exportação");
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    // Cabeçalho: descrição das colunas
+    output_open(&writer->out, fd);
+    output_bytes(&writer->out, COLUMN_MAGIC, 8);
+    write_u32(&writer->out, COLUMN_FORMAT_VERSION);
+    write_u32(&writer->out, COLUMN_BYTE_ORDER);
+    write_u32(&writer->out, COLUMN_COUNT);
+    for (int c = 0; c < COLUMN_COUNT; c++) {
+        write_name(&writer->out, columns[c].name);
+        write_u32(&writer->out, columns[c].type);
+    }
+    return writer;
+}
+
+static void write_chunk(ColumnWriter* writer) {
+    if (writer->rows == 0) return;
+    write_u32(&writer->out, (uint32_t)writer->rows);
+    for (int c = 0; c < COLUMN_COUNT; c++) {
+        output_bytes(&writer->out, writer->data[c], writer->rows * column_width(columns[c].type));
+    }
+    writer->rows = 0;
+}
+
+static inline void set_int32(ColumnWriter* writer, int column, int32_t value) {
+    ((int32_t*)writer->data[column])[writer->rows] = value;
+}
+
+static inline void set_int64(ColumnWriter* writer, int column, int64_t value) {
+    ((int64_t*)writer->data[column])[writer->rows] = value;
+}
+
+void column_writer_add(ColumnWriter* writer, const Process* p) {
+    set_int32(writer, COL_PID, p->pid);
+    set_int64(writer, COL_ARRIVAL, p->arrival_time);
+    set_int64(writer, COL_BURST, p->burst_time);
+    set_int32(writer, COL_PRIORITY, p->priority);
+    set_int64(writer, COL_FIRST_RUN, p->first_run_time);
+    set_int64(writer, COL_COMPLETION, p->completion_time);
+    set_int64(writer, COL_DEADLINE, p->deadline);
+    // A mesma definição de calculate_stats: a soma da coluna é deadline_misses
+    ((uint8_t*)writer->data[COL_MISSED])[writer->rows] =
+        p->deadline > 0 && p->completion_time > p->arrival_time + p->deadline;
+    ((uint8_t*)writer->data[COL_DROPPED])[writer->rows] = p->missed_deadline;
+    set_int32(writer, COL_MISS_COUNT, p->deadline_miss_count);
+    if (++writer->rows == COLUMN_CHUNK_ROWS) write_chunk(writer);
+}
+
+static void write_stat_double(OutputBuffer* out, const char* name, double value) {
+    write_name(out, name);
+    write_u32(out, COLUMN_FLOAT64);
+    output_bytes(out, (const char*)&value, sizeof(value));
+}
+
+bool column_writer_close(ColumnWriter* writer, const SimulationStats* stats) {
+    write_chunk(writer);
+    write_u32(&writer->out, 0);
+
+    write_u32(&writer->out, 6);
+    write_stat_double(&writer->out, "avg_waiting_time", stats->avg_waiting_time);
+    write_stat_double(&writer->out, "avg_turnaround_time", stats->avg_turnaround_time);
+    write_stat_double(&writer->out, "avg_response_time", stats->avg_response_time);
+    write_stat_double(&writer->out, "cpu_utilization", stats->cpu_utilization);
+    write_stat_double(&writer->out, "throughput", stats->throughput);
+    write_name(&writer->out, "deadline_misses");
+    write_u32(&writer->out, COLUMN_INT64);
+    int64_t misses = stats->deadline_misses;
+    output_bytes(&writer->out, (const char*)&misses, sizeof(misses));
+
+    int fd = writer->out.fd;
+    bool ok = output_close(&writer->out);
+    ok = close(fd) == 0 && ok;
+    if (ok) {
+        ok = rename(writer->temp, writer->path) == 0;
+    } else {
+        remove(writer->temp);
+    }
+
+    for (int c = 0; c < COLUMN_COUNT; c++) {
+        free(writer->data[c]);
+    }
+    free(writer);
+    return ok;
+}
+
+bool export_simulation(const char* path, Process** processes, int count, SchedulerType type,
+                       int quantum, SimTime max_time, SimulationStats* stats) {
+    ColumnWriter* writer = column_writer_open(path);
+    if (writer == NULL) return false;
+
+    // A simulação avança em fatias de tempo; depois de cada uma saem os
+    // processos do início do vetor que já têm resultado definitivo. No Rate
+    // Monotonic os processos voltam a ser ativados, por isso só no fim.
+    SchedulerState* state = scheduler_begin(processes, count, type, quantum);
+    SimTime total_burst = 0;
+    SimTime first_arrival = SIM_TIME_MAX, last_arrival = 0;
+    for (int i = 0; i < count; i++) {
+        total_burst += processes[i]->burst_time;
+        if (processes[i]->arrival_time < first_arrival) first_arrival = processes[i]->arrival_time;
+        if (processes[i]->arrival_time > last_arrival) last_arrival = processes[i]->arrival_time;
+    }
+    SimTime span = count > 0 ? last_arrival - first_arrival + total_burst : 1;
+    SimTime interval = span / 256 > 0 ? span / 256 : 1;
+
+    int exported = 0;
+    bool finished = scheduler_finished(state);
+    while (!finished) {
+        finished = scheduler_run_until(state, processes, scheduler_current_time(state) + interval);
+        if (type == RATE_MONOTONIC) continue;
+        while (exported < count && processes[exported]->completion_time != 0) {
+            column_writer_add(writer, processes[exported++]);
+        }
+    }
+    scheduler_state_free(state);
+    while (exported < count) {
+        column_writer_add(writer, processes[exported++]);
+    }
+
+    SimulationStats result = calculate_stats(processes, count, max_time);
+    if (stats != NULL) *stats = result;
+    return column_writer_close(writer, &result);
+}
@@ -0,0 +1,55 @@
+// ----------------------------------------------------------------
+//          Exportação binária por colunas dos resultados
+
+//   Ficheiro autodescritivo, na ordem de bytes da máquina:
+//
+//     "PSCOLS\0\0"                        magia (8 bytes)
+//     u32 versão, u32 0x01020304           (deteta a ordem de bytes)
+//     u32 nº de colunas
+//     por coluna: char nome[24], u32 tipo  (1 = int32, 2 = uint8, 4 = int64)
+//     blocos: u32 nº de linhas (> 0) e, para cada coluna, os valores
+//             desse bloco seguidos (nº de linhas x largura do tipo)
+//     u32 0                                fim dos blocos
+//     u32 nº de estatísticas
+//     por estatística: char nome[24], u32 tipo (3 = float64, 4 = int64), valor
+//
+//   Colunas: pid e priority (int32), arrival, burst, first_run,
+//   completion e deadline (int64), e três factos separados sobre
+//   deadlines:
+//     missed_deadline (uint8)      terminou depois da deadline, com a
+//                                  definição de calculate_stats (a soma da
+//                                  coluna é a estatística deadline_misses)
+//     dropped (uint8)              descartado pelo escalonador (prioridade, EDF)
+//     deadline_miss_count (int32)  ativações perdidas no Rate Monotonic
+//
+//   As linhas seguem a ordem da simulação (por chegada; no Rate
+//   Monotonic por período) e cada bloco é escrito assim que todos os
+//   seus processos terminaram, sem cópia intermédia em texto.
+// ----------------------------------------------------------------
+
+#ifndef EXPORT_H
+#define EXPORT_H
+
+#include <stdbool.h>
+#include "process.h"
+#include "scheduler.h"
+#include "stats.h"
+
+#define COLUMN_FORMAT_VERSION 3
+#define COLUMN_CHUNK_ROWS 65536
+
+typedef struct ColumnWriter ColumnWriter;
+
+// Escreve num ficheiro temporário que só toma o nome 'path' ao fechar
+ColumnWriter* column_writer_open(const char* path);
+void column_writer_add(ColumnWriter* writer, const Process* process);
+
+// Escreve o último bloco e as estatísticas; devolve false se algo falhou
+// (nesse caso o ficheiro não é criado)
+bool column_writer_close(ColumnWriter* writer, const SimulationStats* stats);
+
+// Simula a carga e exporta os resultados à medida que ficam definitivos
+bool export_simulation(const char* path, Process** processes, int count, SchedulerType type,
+                       int quantum, SimTime max_time, SimulationStats* stats);
+
+#endif
@@ -0,0 +1,119 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "heap.h"
+#include "profile.h"
+
+static inline bool node_less(HeapNode a, HeapNode b) {
+    if (a.key != b.key) return a.key < b.key;
+    return a.index < b.index;
+}
+
+void heap_init(Heap* heap, int capacity) {
+    if (capacity < 16) capacity = 16;
+    PROFILE_COUNT(allocations, 1);
+    heap->nodes = (HeapNode*)malloc(capacity * sizeof(HeapNode));
+    if (heap->nodes == NULL) {
+        perror("Erro ao alocar memória para heap");
+        exit(EXIT_FAILURE);
+    }
+    heap->size = 0;
+    heap->capacity = capacity;
+}
+
+void heap_free(Heap* heap) {
+    free(heap->nodes);
+    heap->nodes = NULL;
+    heap->size = 0;
+    heap->capacity = 0;
+}
+
+void heap_copy(Heap* dst, const Heap* src) {
+    if (src->nodes == NULL) {
+        dst->nodes = NULL;
+        dst->size = 0;
+        dst->capacity = 0;
+        return;
+    }
+    heap_init(dst, src->capacity);
+    memcpy(dst->nodes, src->nodes, src->size * sizeof(HeapNode));
+    dst->size = src->size;
+}
+
+void heap_push(Heap* heap, long long key, int index) {
+    PROFILE_COUNT(heap_operations, 1);
+    if (heap->size == heap->capacity) {
+        heap->capacity *= 2;
+        PROFILE_COUNT(allocations, 1);
+        heap->nodes = (HeapNode*)realloc(heap->nodes, heap->capacity * sizeof(HeapNode));
+        if (heap->nodes == NULL) {
+            perror("Erro ao realocar memória para heap");
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    HeapNode node = { key, index };
+    int i = heap->size++;
+
+    // Sobe o nó até a posição correta
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        if (!node_less(node, heap->nodes[parent])) break;
+        heap->nodes[i] = heap->nodes[parent];
+        i = parent;
+    }
+    heap->nodes[i] = node;
+}
+
+HeapNode heap_pop(Heap* heap) {
+    PROFILE_COUNT(heap_operations, 1);
+    HeapNode top = heap->nodes[0];
+    HeapNode last = heap->nodes[--heap->size];
+    int i = 0;
+
+    // Desce o último nó a partir da raiz
+    while (1) {
+        int child = 2 * i + 1;
+        if (child >= heap->size) break;
+        if (child + 1 < heap->size && node_less(heap->nodes[child + 1], heap->nodes[child])) {
+            child++;
+        }
+        if (!node_less(heap->nodes[child], last)) break;
+        heap->nodes[i] = heap->nodes[child];
+        i = child;
+    }
+    if (heap->size > 0) {
+        heap->nodes[i] = last;
+    }
+
+    return top;
+}
+
+void heap_replace_at(Heap* heap, int position, long long key, int index) {
+    PROFILE_COUNT(heap_operations, 1);
+    HeapNode node = { key, index };
+    int i = position;
+
+    // Sobe enquanto for menor que o pai
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        if (!node_less(node, heap->nodes[parent])) break;
+        heap->nodes[i] = heap->nodes[parent];
+        i = parent;
+    }
+
+    // Se não subiu, pode ter de descer
+    if (i == position) {
+        while (1) {
+            int child = 2 * i + 1;
+            if (child >= heap->size) break;
+            if (child + 1 < heap->size && node_less(heap->nodes[child + 1], heap->nodes[child])) {
+                child++;
+            }
+            if (!node_less(heap->nodes[child], node)) break;
+            heap->nodes[i] = heap->nodes[child];
+            i = child;
+        }
+    }
+    heap->nodes[i] = node;
+}
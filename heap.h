@@ -0,0 +1,51 @@
+// ----------------------------------------------------------------
+//   Min-heap de processos prontos usado pelos escalonadores
+
+//   Cada nó guarda uma chave (menor = mais urgente) e a posição do
+//   processo no vetor; empates são resolvidos pela menor posição
+// ----------------------------------------------------------------
+
+#ifndef HEAP_H
+#define HEAP_H
+
+#include <stdbool.h>
+
+typedef struct {
+    long long key;   // Chave de ordenação (menor sai primeiro)
+    int index;       // Posição do processo no vetor (desempate)
+} HeapNode;
+
+typedef struct {
+    HeapNode* nodes;
+    int size;
+    int capacity;
+} Heap;
+
+// Inicializa o heap com capacidade inicial (cresce automaticamente)
+void heap_init(Heap* heap, int capacity);
+
+// Liberta a memória do heap
+void heap_free(Heap* heap);
+
+// Cópia independente de 'src' (um heap nunca inicializado fica vazio)
+void heap_copy(Heap* dst, const Heap* src);
+
+// Insere um nó - O(log N)
+void heap_push(Heap* heap, long long key, int index);
+
+// Remove e devolve o nó de menor chave - O(log N)
+HeapNode heap_pop(Heap* heap);
+
+// Substitui o nó na posição 'position' do vetor interno e repõe a ordem - O(log N)
+void heap_replace_at(Heap* heap, int position, long long key, int index);
+
+// Consulta o nó de menor chave sem o remover
+static inline HeapNode heap_top(const Heap* heap) {
+    return heap->nodes[0];
+}
+
+static inline bool heap_empty(const Heap* heap) {
+    return heap->size == 0;
+}
+
+#endif
@@ -0,0 +1,541 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <errno.h>
+#include "incremental.h"
+#include "scheduler_state.h"
+
+// Resultados de um processo num dado instante da simulação
+typedef struct {
+    SimTime completion_time;
+    SimTime first_run_time;
+    SimTime remaining_time;
+    int deadline_miss_count;
+    bool missed_deadline;
+} ResultFields;
+
+typedef struct {
+    SchedulerState* state;
+    int touched;               // Só as posições [0, touched) podem ter saído do estado inicial
+    ResultFields* results;     // Resultados dessas posições no instante do snapshot
+} IncrementalCheckpoint;
+
+struct IncrementalRun {
+    SchedulerType type;
+    int quantum;
+    SimTime max_time;
+    int count;
+
+    Process* block;            // Cópias da entrada, pela ordem original
+    Process** order;           // Referência na ordem do algoritmo, com os resultados finais
+    SimulationStats stats;
+
+    IncrementalCheckpoint* checkpoints;
+    int checkpoint_count;
+    int checkpoint_capacity;
+
+    Process* scratch;          // Carga editada (mesma disposição que 'block')
+    Process** scratch_order;
+};
+
+// ---------------- Auxiliares ----------------
+
+static void* checked_malloc(size_t size) {
+    void* memory = malloc(size > 0 ? size : 1);
+    if (memory == NULL) {
+        perror("Erro ao alocar memória para a re-simulação");
+        exit(EXIT_FAILURE);
+    }
+    return memory;
+}
+
+// Posições que podem já ter sido tocadas pelo algoritmo no instante do estado
+static int touched_prefix(const SchedulerState* s) {
+    switch (s->type) {
+        case FCFS:
+            return s->completed;
+        case RATE_MONOTONIC:
+            return s->count;
+        case HRRN: {
+            // Só são escolhidos processos já chegados
+            int low = 0, high = s->count;
+            while (low < high) {
+                int middle = low + (high - low) / 2;
+                if (s->arrival[middle] <= s->current_time) low = middle + 1;
+                else high = middle;
+            }
+            return low;
+        }
+        default:
+            return s->next_arrival;
+    }
+}
+
+static ResultFields fields_of(const Process* p) {
+    ResultFields f = { p->completion_time, p->first_run_time, p->remaining_time,
+                       p->deadline_miss_count, p->missed_deadline };
+    return f;
+}
+
+static ResultFields initial_fields(const Process* p) {
+    ResultFields f = { 0, -1, p->burst_time, 0, false };
+    return f;
+}
+
+static void apply_fields(Process* p, const ResultFields* f) {
+    p->completion_time = f->completion_time;
+    p->first_run_time = f->first_run_time;
+    p->remaining_time = f->remaining_time;
+    p->deadline_miss_count = f->deadline_miss_count;
+    p->missed_deadline = f->missed_deadline;
+}
+
+// Resultados da referência na posição p no instante do snapshot
+static ResultFields checkpoint_fields(const IncrementalRun* run, const IncrementalCheckpoint* c, int p) {
+    return p < c->touched ? c->results[p] : initial_fields(run->order[p]);
+}
+
+// A edição move um processo de old_pos para new_pos; as posições entre
+// as duas deslocam-se uma casa
+static inline int map_position(int p, int old_pos, int new_pos) {
+    if (p == old_pos) return new_pos;
+    if (old_pos < new_pos && p > old_pos && p <= new_pos) return p - 1;
+    if (new_pos < old_pos && p >= new_pos && p < old_pos) return p + 1;
+    return p;
+}
+
+static void move_entry(SimTime* array, int old_pos, int new_pos, SimTime value) {
+    if (old_pos < new_pos) {
+        memmove(array + old_pos, array + old_pos + 1, (new_pos - old_pos) * sizeof(SimTime));
+    } else if (new_pos < old_pos) {
+        memmove(array + new_pos + 1, array + new_pos, (old_pos - new_pos) * sizeof(SimTime));
+    }
+    array[new_pos] = value;
+}
+
+static void add_checkpoint(IncrementalRun* run, const SchedulerState* state) {
+    if (run->checkpoint_count == run->checkpoint_capacity) {
+        run->checkpoint_capacity = run->checkpoint_capacity ? run->checkpoint_capacity * 2 : 16;
+        run->checkpoints = (IncrementalCheckpoint*)realloc(run->checkpoints,
+                               run->checkpoint_capacity * sizeof(IncrementalCheckpoint));
+        if (run->checkpoints == NULL) {
+            perror("Erro ao alocar memória para a re-simulação");
+            exit(EXIT_FAILURE);
+        }
+    }
+    IncrementalCheckpoint* c = &run->checkpoints[run->checkpoint_count++];
+    c->state = scheduler_state_clone(state);
+    if (run->checkpoint_count > 1) {
+        // Os vetores derivados da carga são iguais em todos os snapshots
+        scheduler_state_borrow(c->state, run->checkpoints[0].state);
+    }
+    c->touched = touched_prefix(state);
+    c->results = (ResultFields*)checked_malloc(c->touched * sizeof(ResultFields));
+    for (int p = 0; p < c->touched; p++) {
+        c->results[p] = fields_of(run->order[p]);
+    }
+}
+
+// ---------------- Referência ----------------
+
+IncrementalRun* incremental_create(Process** processes, int count, SchedulerType type,
+                                   int quantum, SimTime max_time, int checkpoints) {
+    IncrementalRun* run = (IncrementalRun*)calloc(1, sizeof(IncrementalRun));
+    if (run == NULL) {
+        perror("Erro ao alocar memória para a re-simulação");
+        exit(EXIT_FAILURE);
+    }
+    if (checkpoints < 1) checkpoints = 1;
+    run->type = type;
+    run->quantum = quantum;
+    run->max_time = max_time;
+    run->count = count;
+
+    run->block = (Process*)checked_malloc(count * sizeof(Process));
+    run->order = (Process**)checked_malloc(count * sizeof(Process*));
+    run->scratch = (Process*)checked_malloc(count * sizeof(Process));
+    run->scratch_order = (Process**)checked_malloc(count * sizeof(Process*));
+    SimTime total_burst = 0;
+    SimTime first_arrival = SIM_TIME_MAX, last_arrival = 0;
+    for (int i = 0; i < count; i++) {
+        run->block[i] = *processes[i];
+        run->block[i].missed_deadline = false;
+        run->order[i] = &run->block[i];
+        total_burst += processes[i]->burst_time;
+        if (processes[i]->arrival_time < first_arrival) first_arrival = processes[i]->arrival_time;
+        if (processes[i]->arrival_time > last_arrival) last_arrival = processes[i]->arrival_time;
+    }
+
+    // Intervalo entre snapshots a partir de uma estimativa do instante final
+    SimTime span;
+    if (type == RATE_MONOTONIC) {
+        span = RM_SIMULATION_LIMIT;
+    } else if (count == 0) {
+        span = 1;
+    } else {
+        SimTime busy_end = first_arrival + total_burst;
+        span = (busy_end > last_arrival ? busy_end : last_arrival) - first_arrival;
+    }
+    SimTime interval = span / checkpoints;
+    if (interval < 1) interval = 1;
+
+    SchedulerState* state = scheduler_begin(run->order, count, type, quantum);
+    add_checkpoint(run, state);
+    SimTime next = scheduler_current_time(state) + interval;
+    while (!scheduler_run_until(state, run->order, next)) {
+        add_checkpoint(run, state);
+        next = scheduler_current_time(state) + interval;
+    }
+    scheduler_state_free(state);
+
+    run->stats = calculate_stats(run->order, count, max_time);
+    return run;
+}
+
+void incremental_destroy(IncrementalRun* run) {
+    if (run == NULL) return;
+    for (int k = 0; k < run->checkpoint_count; k++) {
+        scheduler_state_free(run->checkpoints[k].state);
+        free(run->checkpoints[k].results);
+    }
+    free(run->checkpoints);
+    free(run->block);
+    free(run->order);
+    free(run->scratch);
+    free(run->scratch_order);
+    free(run);
+}
+
+SimulationStats incremental_baseline_stats(const IncrementalRun* run) {
+    return run->stats;
+}
+
+// ---------------- Edição ----------------
+
+// Estado do snapshot transposto para a carga editada. Exige que o processo
+// editado e as posições deslocadas ainda não tenham sido admitidos.
+static SchedulerState* rebase_state(const IncrementalRun* run, const SchedulerState* base,
+                                    const Process* edited, int old_pos, int new_pos) {
+    if (base->type == HRRN) {
+        // Os grupos dependem dos bursts: refazem-se, e cada grupo avança
+        // sobre os membros já concluídos (sempre um prefixo da fila)
+        SchedulerState* s = scheduler_state_create(run->scratch_order, run->count, HRRN,
+                                                   base->quantum, base->aging_interval);
+        s->current_time = base->current_time;
+        s->completed = base->completed;
+        for (int b = 0; b < s->bucket_count; b++) {
+            while (s->bucket_head[b] != -1 &&
+                   run->scratch_order[s->bucket_head[b]]->completion_time != 0) {
+                s->bucket_head[b] = s->bucket_next[s->bucket_head[b]];
+            }
+        }
+        return s;
+    }
+
+    SchedulerState* s = scheduler_state_clone(base);
+    move_entry(s->arrival, old_pos, new_pos, edited->arrival_time);
+    if (s->key != NULL) {
+        move_entry(s->key, old_pos, new_pos, s->type == EDF ? edited->arrival_time + edited->deadline
+                                                            : edited->burst_time);
+    }
+    if (s->remaining != NULL) {
+        move_entry(s->remaining, old_pos, new_pos, edited->burst_time);
+    }
+    if (s->type == RATE_MONOTONIC) {
+        s->release[new_pos] = edited->arrival_time;
+    }
+
+    // Fila de deadlines (ou de ativações, no Rate Monotonic): as posições
+    // deslocadas mantêm a ordem relativa, só a entrada do processo editado
+    // muda de chave
+    if (s->expiry.nodes != NULL) {
+        int edited_node = -1;
+        for (int n = 0; n < s->expiry.size; n++) {
+            if (s->expiry.nodes[n].index == old_pos) {
+                edited_node = n;
+                break;
+            }
+        }
+        for (int n = 0; n < s->expiry.size; n++) {
+            if (n != edited_node) {
+                s->expiry.nodes[n].index = map_position(s->expiry.nodes[n].index, old_pos, new_pos);
+            }
+        }
+        if (edited_node != -1) {
+            SimTime key = s->type == RATE_MONOTONIC ? edited->arrival_time
+                                                    : edited->arrival_time + edited->deadline;
+            heap_replace_at(&s->expiry, edited_node, key, new_pos);
+        }
+    }
+    return s;
+}
+
+static int compare_nodes(const void* a, const void* b) {
+    const HeapNode* x = (const HeapNode*)a;
+    const HeapNode* y = (const HeapNode*)b;
+    if (x->key != y->key) return (x->key > y->key) - (x->key < y->key);
+    return (x->index > y->index) - (x->index < y->index);
+}
+
+// Entradas do heap ainda relevantes (processos por terminar), com as
+// posições opcionalmente convertidas para a carga editada
+static int live_nodes(const Heap* heap, const SimTime* remaining, HeapNode* out,
+                      int old_pos, int new_pos, bool map) {
+    int live = 0;
+    for (int n = 0; n < heap->size; n++) {
+        HeapNode node = heap->nodes[n];
+        if (remaining[node.index] <= 0) continue;
+        if (map) node.index = map_position(node.index, old_pos, new_pos);
+        out[live++] = node;
+    }
+    qsort(out, live, sizeof(HeapNode), compare_nodes);
+    return live;
+}
+
+static bool heaps_match(const Heap* edited, const SimTime* edited_remaining,
+                        const Heap* base, const SimTime* base_remaining, int old_pos, int new_pos) {
+    if (edited->nodes == NULL || base->nodes == NULL) {
+        return edited->nodes == base->nodes;
+    }
+    HeapNode* a = (HeapNode*)checked_malloc(edited->size * sizeof(HeapNode));
+    HeapNode* b = (HeapNode*)checked_malloc(base->size * sizeof(HeapNode));
+    int live_a = live_nodes(edited, edited_remaining, a, old_pos, new_pos, false);
+    int live_b = live_nodes(base, base_remaining, b, old_pos, new_pos, true);
+    // Campo a campo: HeapNode tem bytes de enchimento
+    bool same = live_a == live_b;
+    for (int n = 0; same && n < live_a; n++) {
+        same = a[n].key == b[n].key && a[n].index == b[n].index;
+    }
+    free(a);
+    free(b);
+    return same;
+}
+
+static inline int map_optional(int p, int old_pos, int new_pos) {
+    return p < 0 ? p : map_position(p, old_pos, new_pos);
+}
+
+// O futuro das duas simulações é igual a partir daqui? Exige que o processo
+// editado já tenha terminado em ambas (deixa de influenciar as decisões)
+static bool states_match(const IncrementalRun* run, const SchedulerState* s,
+                         const IncrementalCheckpoint* c, int old_pos, int new_pos) {
+    const SchedulerState* b = c->state;
+    if (s->current_time != b->current_time || s->completed != b->completed ||
+        s->next_arrival != b->next_arrival) {
+        return false;
+    }
+    if (run->scratch_order[new_pos]->completion_time == 0 ||
+        checkpoint_fields(run, c, old_pos).completion_time == 0) {
+        return false;
+    }
+
+    // Tempos restantes e o que já foi registado em cada processo
+    int touched_s = touched_prefix(s);
+    int prefix = touched_s > c->touched ? touched_s : c->touched;
+    for (int p = 0; p < prefix; p++) {
+        if (p == old_pos) continue;
+        int q = map_position(p, old_pos, new_pos);
+        if (b->remaining != NULL && s->remaining[q] != b->remaining[p]) return false;
+
+        ResultFields base = checkpoint_fields(run, c, p);
+        const Process* edited = run->scratch_order[q];
+        if ((edited->completion_time != 0) != (base.completion_time != 0) ||
+            (edited->first_run_time != -1) != (base.first_run_time != -1)) {
+            return false;
+        }
+    }
+
+    if (s->type == ROUND_ROBIN) {
+        if (s->cursor != map_optional(b->cursor, old_pos, new_pos) ||
+            s->prev != map_optional(b->prev, old_pos, new_pos) ||
+            s->tail != map_optional(b->tail, old_pos, new_pos) ||
+            s->last_run != map_optional(b->last_run, old_pos, new_pos)) {
+            return false;
+        }
+        int x = s->head, y = b->head;
+        while (x != -1 && y != -1) {
+            if (x != map_position(y, old_pos, new_pos)) return false;
+            x = s->next[x];
+            y = b->next[y];
+        }
+        if (x != y) return false;
+    }
+
+    if (b->remaining != NULL) {
+        return heaps_match(&s->ready, s->remaining, &b->ready, b->remaining, old_pos, new_pos) &&
+               heaps_match(&s->expiry, s->remaining, &b->expiry, b->remaining, old_pos, new_pos);
+    }
+    return true;
+}
+
+// Resultado final = o da simulação editada no instante de reencontro mais
+// as alterações que a referência ainda fez a partir daí (que se repetem
+// igualmente na simulação editada)
+static void splice_results(IncrementalRun* run, const IncrementalCheckpoint* c,
+                           int old_pos, int new_pos) {
+    for (int p = 0; p < run->count; p++) {
+        Process* edited = run->scratch_order[map_position(p, old_pos, new_pos)];
+        const Process* final = run->order[p];
+        ResultFields at = checkpoint_fields(run, c, p);
+
+        if (final->completion_time != at.completion_time) edited->completion_time = final->completion_time;
+        if (final->first_run_time != at.first_run_time) edited->first_run_time = final->first_run_time;
+        if (final->remaining_time != at.remaining_time) edited->remaining_time = final->remaining_time;
+        if (final->missed_deadline != at.missed_deadline) edited->missed_deadline = final->missed_deadline;
+        edited->deadline_miss_count += final->deadline_miss_count - at.deadline_miss_count;
+    }
+}
+
+static int find_pid(const IncrementalRun* run, int pid) {
+    for (int p = 0; p < run->count; p++) {
+        if (run->order[p]->pid == pid) return p;
+    }
+    return -1;
+}
+
+// Primeira posição (exceto 'skip') que vem depois do processo na ordem do algoritmo:
+// chegada e, em empate, a posição na entrada (a ordenação é estável)
+static int insertion_position(const IncrementalRun* run, const Process* edited) {
+    int low = 0, high = run->count - 1;
+    while (low < high) {
+        int middle = low + (high - low) / 2;
+        const Process* p = run->scratch_order[middle];
+        bool before = p->arrival_time < edited->arrival_time ||
+                      (p->arrival_time == edited->arrival_time && p < edited);
+        if (before) low = middle + 1;
+        else high = middle;
+    }
+    return low;
+}
+
+bool incremental_evaluate(IncrementalRun* run, const ProcessEdit* edit, SimulationStats* stats,
+                          Process*** results, IncrementalInfo* info) {
+    int old_pos = find_pid(run, edit->pid);
+    if (old_pos < 0 || (edit->burst_time != -1 && edit->burst_time < 1) ||
+        edit->arrival_time < -1 || edit->priority < -1) {
+        return false;
+    }
+
+    // Carga editada, com a disposição da referência
+    int count = run->count;
+    memcpy(run->scratch, run->block, count * sizeof(Process));
+    for (int p = 0; p < count; p++) {
+        run->scratch_order[p] = run->scratch + (run->order[p] - run->block);
+    }
+    Process* edited = run->scratch_order[old_pos];
+    SimTime old_arrival = edited->arrival_time;
+    if (edit->arrival_time != -1) edited->arrival_time = edit->arrival_time;
+    if (edit->burst_time != -1) edited->burst_time = edit->burst_time;
+    if (edit->priority != -1) edited->priority = edit->priority;
+
+    int new_pos = old_pos;
+    if (run->type != RATE_MONOTONIC && edited->arrival_time != old_arrival) {
+        memmove(run->scratch_order + old_pos, run->scratch_order + old_pos + 1,
+                (count - old_pos - 1) * sizeof(Process*));
+        new_pos = insertion_position(run, edited);
+        memmove(run->scratch_order + new_pos + 1, run->scratch_order + new_pos,
+                (count - 1 - new_pos) * sizeof(Process*));
+        run->scratch_order[new_pos] = edited;
+    }
+
+    // Último snapshot em que o processo editado (na versão antiga e na nova)
+    // ainda não tinha chegado
+    SimTime limit = old_arrival < edited->arrival_time ? old_arrival : edited->arrival_time;
+    int restart = -1;
+    for (int k = run->checkpoint_count - 1; k >= 0; k--) {
+        if (run->checkpoints[k].state->current_time < limit) {
+            restart = k;
+            break;
+        }
+    }
+
+    SchedulerState* state;
+    if (restart == -1) {
+        for (int p = 0; p < count; p++) {
+            ResultFields initial = initial_fields(run->scratch_order[p]);
+            apply_fields(run->scratch_order[p], &initial);
+        }
+        state = scheduler_state_create(run->scratch_order, count, run->type, run->quantum,
+                                       run->checkpoints[0].state->aging_interval);
+    } else {
+        const IncrementalCheckpoint* c = &run->checkpoints[restart];
+        for (int p = 0; p < count; p++) {
+            Process* x = run->scratch_order[map_position(p, old_pos, new_pos)];
+            ResultFields f = p < c->touched ? c->results[p] : initial_fields(x);
+            apply_fields(x, &f);
+        }
+        edited->remaining_time = edited->burst_time;
+        state = rebase_state(run, c->state, edited, old_pos, new_pos);
+    }
+
+    IncrementalInfo local = { restart == -1 ? 0 : run->checkpoints[restart].state->current_time, -1 };
+
+    // Corre de snapshot em snapshot até o estado coincidir com o da referência.
+    // No Rate Monotonic os processos são periódicos e a diferença nunca desaparece.
+    bool finished = false;
+    for (int k = restart + 1; k < run->checkpoint_count && !finished; k++) {
+        const IncrementalCheckpoint* c = &run->checkpoints[k];
+        finished = scheduler_run_until(state, run->scratch_order, c->state->current_time);
+        if (!finished && run->type != RATE_MONOTONIC &&
+            states_match(run, state, c, old_pos, new_pos)) {
+            splice_results(run, c, old_pos, new_pos);
+            local.rejoin_time = c->state->current_time;
+            finished = true;
+        }
+    }
+    if (!finished) {
+        scheduler_run_until(state, run->scratch_order, SIM_TIME_MAX);
+    }
+    scheduler_state_free(state);
+
+    if (stats != NULL) *stats = calculate_stats(run->scratch_order, count, run->max_time);
+    if (results != NULL) *results = run->scratch_order;
+    if (info != NULL) *info = local;
+    return true;
+}
+
+bool parse_process_edit(const char* text, ProcessEdit* edit) {
+    edit->pid = -1;
+    edit->arrival_time = -1;
+    edit->burst_time = -1;
+    edit->priority = -1;
+
+    char* copy = strdup(text);
+    if (copy == NULL) {
+        perror("Erro ao alocar memória para a re-simulação");
+        exit(EXIT_FAILURE);
+    }
+    bool ok = true;
+    char* save;
+    for (char* item = strtok_r(copy, ",", &save); ok && item != NULL; item = strtok_r(NULL, ",", &save)) {
+        char* equals = strchr(item, '=');
+        char* end;
+        if (equals == NULL) {
+            ok = false;
+            break;
+        }
+        *equals = '\0';
+        errno = 0;
+        long long value = strtoll(equals + 1, &end, 10);
+        bool is_time = strcmp(item, "arrival") == 0 || strcmp(item, "burst") == 0;
+        if (end == equals + 1 || *end != '\0' || errno == ERANGE || value < 0 ||
+            (!is_time && value > INT_MAX)) {
+            ok = false;
+        } else if (strcmp(item, "pid") == 0) {
+            edit->pid = (int)value;
+        } else if (strcmp(item, "arrival") == 0) {
+            edit->arrival_time = value;
+        } else if (strcmp(item, "burst") == 0) {
+            edit->burst_time = value;
+        } else if (strcmp(item, "priority") == 0) {
+            edit->priority = (int)value;
+        } else {
+            ok = false;
+        }
+    }
+    free(copy);
+    return ok && edit->pid >= 0;
+}
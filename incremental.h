@@ -0,0 +1,50 @@
+// ----------------------------------------------------------------
+//           Re-simulação incremental após edições da carga
+
+//   A simulação de referência guarda snapshots periódicos do estado.
+//   Uma edição (chegada, burst ou prioridade de um processo) recomeça
+//   no último snapshot anterior à mudança e, assim que o estado volta a
+//   coincidir com o da referência num snapshot posterior, pára e
+//   completa os resultados com os da referência.
+// ----------------------------------------------------------------
+
+#ifndef INCREMENTAL_H
+#define INCREMENTAL_H
+
+#include <stdbool.h>
+#include "process.h"
+#include "scheduler.h"
+#include "stats.h"
+
+typedef struct IncrementalRun IncrementalRun;
+
+// Alteração de um processo (-1 = campo inalterado)
+typedef struct {
+    int pid;
+    SimTime arrival_time;
+    SimTime burst_time;
+    int priority;
+} ProcessEdit;
+
+typedef struct {
+    SimTime restart_time;   // Instante do snapshot de onde a simulação recomeçou
+    SimTime rejoin_time;    // Instante em que voltou à referência (-1 = correu até ao fim)
+} IncrementalInfo;
+
+// Simula a carga (que não é alterada) guardando cerca de 'checkpoints' snapshots
+IncrementalRun* incremental_create(Process** processes, int count, SchedulerType type,
+                                   int quantum, SimTime max_time, int checkpoints);
+void incremental_destroy(IncrementalRun* run);
+
+SimulationStats incremental_baseline_stats(const IncrementalRun* run);
+
+// Avalia uma edição sem alterar a referência. Os resultados por processo da
+// carga editada ficam em *results (opcional; válidos até à próxima avaliação).
+// Devolve false se o pid não existir ou a edição for inválida.
+bool incremental_evaluate(IncrementalRun* run, const ProcessEdit* edit, SimulationStats* stats,
+                          Process*** results, IncrementalInfo* info);
+
+// Lê uma edição do tipo "pid=12,burst=30,arrival=400,priority=2"
+bool parse_process_edit(const char* text, ProcessEdit* edit);
+
+#endif
@@ -0,0 +1,496 @@
+// Afinidade de threads (pthread_setaffinity_np) e ucontext
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <signal.h>
+#include <sched.h>
+#include <pthread.h>
+#include <ucontext.h>
+#include <sys/time.h>
+#include "live.h"
+#include "scheduler_state.h"
+
+#define LIVE_STACK_SIZE (32 * 1024)
+#define LIVE_CALIBRATION_ITERATIONS (1 << 20)
+#define LIVE_POLLS_PER_UNIT 8      // Verificações do sinal e do fim da fatia por unidade
+
+// Corrotina de um processo. As pilhas são reaproveitadas: quando um
+// processo termina, a sua corrotina fica livre para o próximo.
+typedef struct LiveTask {
+    ucontext_t context;
+    char* stack;
+    struct timespec until;     // Fim (em tempo real) da decisão em curso
+    struct LiveTask* next_free;
+} LiveTask;
+
+typedef struct {
+    ucontext_t dispatcher;
+    LiveTask* running;
+    long long unit_iterations;
+    long long poll_iterations;    // Trabalho entre verificações
+    struct timespec resumed_at;   // Escritos pela corrotina ao receber e ao
+    struct timespec yielded_at;   // devolver a CPU (custo de cada troca)
+    LiveTask** task_of;           // Corrotina de cada processo (NULL = ainda não tem)
+    LiveTask* free_tasks;
+} LiveRuntime;
+
+typedef struct {
+    Process** processes;
+    int count;
+    const LiveConfig* config;
+    LiveResult* result;
+    bool ok;
+} LiveJob;
+
+// O temporizador é do processo: uma execução de cada vez
+static LiveRuntime* live;
+static volatile sig_atomic_t preempt_pending;
+static volatile struct timespec preempt_signal_time;
+static volatile unsigned long long live_sink;
+
+static void* live_alloc(size_t size) {
+    void* pointer = calloc(1, size);
+    if (pointer == NULL) {
+        perror("Erro ao alocar memória para a execução real");
+        exit(EXIT_FAILURE);
+    }
+    return pointer;
+}
+
+static inline long long elapsed_ns(const struct timespec* from, const struct timespec* to) {
+    return (long long)(to->tv_sec - from->tv_sec) * 1000000000LL + (to->tv_nsec - from->tv_nsec);
+}
+
+static void on_timer(int signo) {
+    (void)signo;
+    if (!preempt_pending) {
+        struct timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        preempt_signal_time.tv_sec = now.tv_sec;
+        preempt_signal_time.tv_nsec = now.tv_nsec;
+        preempt_pending = 1;
+    }
+}
+
+// Trabalho sintético: um gerador congruencial que o compilador não pode eliminar
+static void burn(long long iterations) {
+    unsigned long long x = live_sink;
+    for (long long i = 0; i < iterations; i++) {
+        x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+    }
+    live_sink = x;
+}
+
+// Iterações de burn() que demoram uma unidade (o melhor de várias medições)
+static long long calibrate(double unit_us) {
+    long long best = -1;
+    for (int attempt = 0; attempt < 5; attempt++) {
+        struct timespec start, end;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        burn(LIVE_CALIBRATION_ITERATIONS);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        long long ns = elapsed_ns(&start, &end);
+        if (best < 0 || ns < best) best = ns;
+    }
+    if (best <= 0) best = 1;
+    long long iterations = (long long)(unit_us * 1000.0 * LIVE_CALIBRATION_ITERATIONS / best);
+    return iterations > 0 ? iterations : 1;
+}
+
+static inline bool reached(const struct timespec* now, const struct timespec* target) {
+    return now->tv_sec > target->tv_sec ||
+           (now->tv_sec == target->tv_sec && now->tv_nsec >= target->tv_nsec);
+}
+
+// Trabalha até ao fim da decisão ou até ao próximo sinal do temporizador
+static void coroutine_main(void) {
+    for (;;) {
+        clock_gettime(CLOCK_MONOTONIC, &live->resumed_at);
+        LiveTask* task = live->running;
+        struct timespec now = live->resumed_at;
+        while (!preempt_pending && !reached(&now, &task->until)) {
+            burn(live->poll_iterations);
+            clock_gettime(CLOCK_MONOTONIC, &now);
+        }
+        clock_gettime(CLOCK_MONOTONIC, &live->yielded_at);
+        swapcontext(&task->context, &live->dispatcher);
+    }
+}
+
+// Contexto novo a começar em coroutine_main (função à parte: getcontext
+// regressa como setjmp e as variáveis alteradas antes não sobrevivem)
+static void task_reset_context(LiveTask* task) {
+    getcontext(&task->context);
+    task->context.uc_stack.ss_sp = task->stack;
+    task->context.uc_stack.ss_size = LIVE_STACK_SIZE;
+    task->context.uc_link = NULL;
+    makecontext(&task->context, coroutine_main, 0);
+}
+
+static LiveTask* task_acquire(LiveRuntime* rt, int index) {
+    if (rt->task_of[index] != NULL) return rt->task_of[index];
+
+    LiveTask* task = rt->free_tasks;
+    if (task != NULL) {
+        rt->free_tasks = task->next_free;
+    } else {
+        task = (LiveTask*)live_alloc(sizeof(LiveTask));
+        task->stack = (char*)live_alloc(LIVE_STACK_SIZE);
+    }
+    task_reset_context(task);
+    rt->task_of[index] = task;
+    return task;
+}
+
+static void task_release(LiveRuntime* rt, int index) {
+    LiveTask* task = rt->task_of[index];
+    if (task == NULL) return;
+    task->next_free = rt->free_tasks;
+    rt->free_tasks = task;
+    rt->task_of[index] = NULL;
+}
+
+// Espera (sem ocupar a CPU) até 'target'; o temporizador interrompe o sono
+static void wait_until(const struct timespec* target) {
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, target, NULL) == EINTR) {
+    }
+}
+
+static struct timespec add_ns(struct timespec base, long long ns) {
+    base.tv_sec += ns / 1000000000LL;
+    base.tv_nsec += ns % 1000000000LL;
+    if (base.tv_nsec >= 1000000000L) {
+        base.tv_sec++;
+        base.tv_nsec -= 1000000000L;
+    }
+    return base;
+}
+
+// Tempo real decorrido desde 'base', em unidades simuladas (arredondado para cima)
+static SimTime units_since(const struct timespec* base, double unit_ns) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    double units = elapsed_ns(base, &now) / unit_ns;
+    SimTime whole = (SimTime)units;
+    return whole < units ? whole + 1 : whole;
+}
+
+// Instante (relativo ao início) em que começa a unidade 'units'
+static long long units_to_ns(SimTime units, double unit_ns) {
+    double ns = units * unit_ns;
+    long long whole = (long long)ns;
+    return whole < ns ? whole + 1 : whole;
+}
+
+// Unidade simulada em curso no instante real atual (arredondado para baixo)
+static SimTime current_unit(const struct timespec* base, double unit_ns) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (SimTime)(elapsed_ns(base, &now) / unit_ns);
+}
+
+static bool pin_thread(int cpu, int* pinned) {
+    cpu_set_t allowed;
+    if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0) return false;
+    if (cpu < 0) {
+        for (cpu = 0; cpu < CPU_SETSIZE && !CPU_ISSET(cpu, &allowed); cpu++) {
+        }
+    }
+    if (cpu >= CPU_SETSIZE || !CPU_ISSET(cpu, &allowed)) return false;
+
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0) return false;
+    *pinned = cpu;
+    return true;
+}
+
+static void dispatch(LiveJob* job) {
+    Process** processes = job->processes;
+    int count = job->count;
+    const LiveConfig* config = job->config;
+    LiveResult* result = job->result;
+    double unit_ns = config->unit_us * 1000.0;
+
+    LiveRuntime rt;
+    memset(&rt, 0, sizeof(rt));
+    rt.unit_iterations = calibrate(config->unit_us);
+    rt.poll_iterations = rt.unit_iterations / LIVE_POLLS_PER_UNIT + 1;
+    rt.task_of = (LiveTask**)live_alloc((count > 0 ? count : 1) * sizeof(LiveTask*));
+    live = &rt;
+    result->unit_iterations = rt.unit_iterations;
+
+    // Instantes medidos por processo (posição no vetor ordenado)
+    SimTime* completion = (SimTime*)live_alloc((count > 0 ? count : 1) * sizeof(SimTime));
+    SimTime* first_run = (SimTime*)live_alloc((count > 0 ? count : 1) * sizeof(SimTime));
+    for (int i = 0; i < count; i++) {
+        first_run[i] = -1;
+    }
+
+    SchedulerState* state = scheduler_begin(processes, count, config->type, config->quantum);
+    state->verbose = false;
+    scheduler_state_record(state, true);
+
+    long long switch_total = 0;
+    long long latency_total = 0;
+    long long latency_max = 0;
+    struct timespec base;
+    clock_gettime(CLOCK_MONOTONIC, &base);
+
+    // O relógio do escalonador é o tempo real: em cada ponto de decisão
+    // (sinal do temporizador ou fim da fatia) o escalonador avança até à
+    // unidade atual e a corrotina a executar é a da decisão que a cobre
+    SchedulerEvent current;
+    bool have_current = false;
+    bool current_ran = false;
+    for (;;) {
+        SimTime now = current_unit(&base, unit_ns);
+        if (have_current && current.start + current.length <= now) {
+            if (!current_ran) {
+                result->skipped_slices++;
+                result->skipped_units += current.length;
+            }
+            if (current.completed) {
+                completion[current.index] = units_since(&base, unit_ns);
+                // No Rate Monotonic o processo volta a ser ativado
+                if (config->type != RATE_MONOTONIC) task_release(&rt, current.index);
+            }
+            have_current = false;
+        }
+
+        if (!have_current) {
+            SchedulerEvent event;
+            if (scheduler_next_event(state, &event)) {
+                if (event.type == SCHED_EVENT_MISS) {
+                    completion[event.index] = units_since(&base, unit_ns);
+                    task_release(&rt, event.index);
+                } else {
+                    if (event.start + event.length > result->makespan) {
+                        result->makespan = event.start + event.length;
+                    }
+                    current = event;
+                    have_current = true;
+                    current_ran = false;
+                    result->slices++;
+                }
+                continue;
+            }
+            if (scheduler_finished(state)) break;
+            if (state->current_time <= now) {
+                // As decisões são pedidas uma unidade de cada vez, como faria
+                // um escalonador que só conhece o presente. O tempo que o
+                // dispatcher perdeu (sono, trocas) conta como CPU livre.
+                state->current_time = now;
+                scheduler_run_until(state, processes, now + 1);
+                continue;
+            }
+            // Nada pronto: a CPU fica livre até à próxima chegada
+            struct timespec next = add_ns(base, units_to_ns(scheduler_current_time(state), unit_ns));
+            wait_until(&next);
+            continue;
+        }
+
+        if (current.start > now) {
+            struct timespec start = add_ns(base, units_to_ns(current.start, unit_ns));
+            wait_until(&start);
+            continue;
+        }
+
+        int index = current.index;
+        LiveTask* task = task_acquire(&rt, index);
+        if (first_run[index] < 0) first_run[index] = units_since(&base, unit_ns);
+        task->until = add_ns(base, units_to_ns(current.start + current.length, unit_ns));
+
+        // Interrupções ocorridas fora da corrotina não contam
+        preempt_pending = 0;
+        struct timespec before, after;
+        clock_gettime(CLOCK_MONOTONIC, &before);
+        rt.running = task;
+        current_ran = true;
+        swapcontext(&rt.dispatcher, &task->context);
+        clock_gettime(CLOCK_MONOTONIC, &after);
+        rt.running = NULL;
+
+        switch_total += elapsed_ns(&before, &rt.resumed_at) + elapsed_ns(&rt.yielded_at, &after);
+        result->switches += 2;
+        if (preempt_pending) {
+            // A próxima volta decide de novo a partir do tempo real
+            struct timespec signaled = { preempt_signal_time.tv_sec, preempt_signal_time.tv_nsec };
+            long long latency = elapsed_ns(&signaled, &after);
+            latency_total += latency;
+            if (latency > latency_max) latency_max = latency;
+            result->preemptions++;
+        }
+    }
+
+    struct timespec end;
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    result->wall_seconds = elapsed_ns(&base, &end) / 1e9;
+    scheduler_state_free(state);
+
+    result->switch_ns = result->switches > 0 ? (double)switch_total / result->switches : 0.0;
+    result->preempt_latency_ns = result->preemptions > 0 ? (double)latency_total / result->preemptions : 0.0;
+    result->preempt_latency_max_ns = (double)latency_max;
+    result->dispatched = calculate_stats(processes, count, config->max_time);
+
+    // Estatísticas dos mesmos processos com os instantes medidos
+    Process* copies = (Process*)live_alloc((count > 0 ? count : 1) * sizeof(Process));
+    Process** measured = (Process**)live_alloc((count > 0 ? count : 1) * sizeof(Process*));
+    for (int i = 0; i < count; i++) {
+        copies[i] = *processes[i];
+        copies[i].completion_time = completion[i];
+        if (copies[i].first_run_time != -1) copies[i].first_run_time = first_run[i];
+        measured[i] = &copies[i];
+    }
+    result->measured = calculate_stats(measured, count, config->max_time);
+    free(measured);
+    free(copies);
+
+    for (int i = 0; i < count; i++) {
+        task_release(&rt, i);
+    }
+    while (rt.free_tasks != NULL) {
+        LiveTask* task = rt.free_tasks;
+        rt.free_tasks = task->next_free;
+        free(task->stack);
+        free(task);
+    }
+    free(rt.task_of);
+    free(completion);
+    free(first_run);
+    live = NULL;
+}
+
+static void* live_thread(void* arg) {
+    LiveJob* job = (LiveJob*)arg;
+    if (!pin_thread(job->config->cpu, &job->result->cpu)) return NULL;
+
+    struct itimerval timer;
+    memset(&timer, 0, sizeof(timer));
+    timer.it_interval.tv_sec = job->config->timer_us / 1000000;
+    timer.it_interval.tv_usec = job->config->timer_us % 1000000;
+    timer.it_value = timer.it_interval;
+
+    // Só esta thread recebe o sinal do temporizador
+    sigset_t alarm;
+    sigemptyset(&alarm);
+    sigaddset(&alarm, SIGALRM);
+    pthread_sigmask(SIG_UNBLOCK, &alarm, NULL);
+    if (setitimer(ITIMER_REAL, &timer, NULL) != 0) return NULL;
+
+    dispatch(job);
+
+    memset(&timer, 0, sizeof(timer));
+    setitimer(ITIMER_REAL, &timer, NULL);
+    pthread_sigmask(SIG_BLOCK, &alarm, NULL);
+    job->ok = true;
+    return NULL;
+}
+
+LiveConfig default_live_config(void) {
+    LiveConfig config;
+    config.type = FCFS;
+    config.quantum = 4;
+    config.max_time = 100;
+    config.unit_us = 10.0;
+    config.timer_us = 1000;
+    config.cpu = -1;
+    return config;
+}
+
+// Referência determinística: schedule() sobre cópias dos processos
+static SimulationStats simulate_copy(Process** processes, int count, const LiveConfig* config) {
+    Process** copies = (Process**)live_alloc((count > 0 ? count : 1) * sizeof(Process*));
+    for (int i = 0; i < count; i++) {
+        copies[i] = clone_process(processes[i]);
+    }
+    bool verbose = scheduler_is_verbose();
+    set_scheduler_verbose(false);
+    schedule(copies, count, config->type, config->quantum, config->max_time);
+    set_scheduler_verbose(verbose);
+    SimulationStats stats = calculate_stats(copies, count, config->max_time);
+    for (int i = 0; i < count; i++) {
+        free_process(copies[i]);
+    }
+    free(copies);
+    return stats;
+}
+
+bool live_run(Process** processes, int count, const LiveConfig* config, LiveResult* result) {
+    memset(result, 0, sizeof(LiveResult));
+    if (config->unit_us <= 0 || config->timer_us <= 0) return false;
+    result->simulated = simulate_copy(processes, count, config);
+
+    struct sigaction action, previous;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = on_timer;
+    sigemptyset(&action.sa_mask);
+    if (sigaction(SIGALRM, &action, &previous) != 0) return false;
+
+    // As restantes threads (incluindo esta) não recebem o SIGALRM
+    sigset_t alarm, saved;
+    sigemptyset(&alarm);
+    sigaddset(&alarm, SIGALRM);
+    pthread_sigmask(SIG_BLOCK, &alarm, &saved);
+
+    LiveJob job = { processes, count, config, result, false };
+    pthread_t thread;
+    if (pthread_create(&thread, NULL, live_thread, &job) == 0) {
+        pthread_join(thread, NULL);
+    }
+
+    // Um sinal gerado entre o fim da execução e o desarme fica pendente
+    sigset_t pending;
+    sigpending(&pending);
+    if (sigismember(&pending, SIGALRM)) {
+        int signo;
+        sigwait(&alarm, &signo);
+    }
+    pthread_sigmask(SIG_SETMASK, &saved, NULL);
+    sigaction(SIGALRM, &previous, NULL);
+    return job.ok;
+}
+
+void print_live_result(const LiveConfig* config, const LiveResult* result) {
+    const SimulationStats* s = &result->simulated;
+    const SimulationStats* d = &result->dispatched;
+    const SimulationStats* m = &result->measured;
+
+    printf("\n=== Execução Real (corrotinas) ===\n");
+    printf("CPU:                      %d\n", result->cpu);
+    printf("Unidade de tempo:         %.2f µs (%lld iterações de trabalho)\n",
+           config->unit_us, result->unit_iterations);
+    printf("Temporizador:             %d µs\n", config->timer_us);
+    printf("Tempo real:               %.3f s (%lld unidades simuladas = %.3f s)\n",
+           result->wall_seconds, result->makespan, result->makespan * config->unit_us / 1e6);
+    printf("Trocas de contexto:       %lld (%.0f ns em média)\n", result->switches, result->switch_ns);
+    printf("Preempções:               %lld", result->preemptions);
+    if (result->preemptions > 0) {
+        printf(" (latência média %.0f ns, máxima %.0f ns)",
+               result->preempt_latency_ns, result->preempt_latency_max_ns);
+    }
+    printf("\n");
+    printf("Fatias decididas:         %lld (%lld perdidas por atraso, %lld unidades)\n",
+           result->slices, result->skipped_slices, result->skipped_units);
+    printf("\n");
+    printf("Simulado: schedule() sobre uma cópia; Decidido: decisões com o relógio real\n");
+    printf("                            Simulado     Decidido       Medido\n");
+    printf("Tempo médio de espera:    %12.2f %12.2f %12.2f\n",
+           s->avg_waiting_time, d->avg_waiting_time, m->avg_waiting_time);
+    printf("Tempo médio de retorno:   %12.2f %12.2f %12.2f\n",
+           s->avg_turnaround_time, d->avg_turnaround_time, m->avg_turnaround_time);
+    printf("Tempo médio de resposta:  %12.2f %12.2f %12.2f\n",
+           s->avg_response_time, d->avg_response_time, m->avg_response_time);
+    printf("Utilização da CPU (%%):    %12.2f %12.2f %12.2f\n",
+           s->cpu_utilization, d->cpu_utilization, m->cpu_utilization);
+    printf("Throughput:               %12.4f %12.4f %12.4f\n",
+           s->throughput, d->throughput, m->throughput);
+    printf("Deadlines perdidas:       %12lld %12lld %12lld\n",
+           s->deadline_misses, d->deadline_misses, m->deadline_misses);
+    printf("==================================\n");
+}
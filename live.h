@@ -0,0 +1,73 @@
+// ----------------------------------------------------------------
+//          Execução real da carga em corrotinas (Linux)
+
+//   Cada processo passa a ser uma corrotina (ucontext) que gasta CPU
+//   enquanto o escalonador lho atribui, à razão de 'unit_us'
+//   microssegundos por unidade de tempo simulado. As corrotinas
+//   partilham uma única thread fixa num CPU e o relógio do escalonador
+//   é o tempo real: em cada ponto de decisão o dispatcher avança o
+//   escalonador até à unidade atual e entrega a CPU à corrotina da
+//   decisão que a cobre, até ao fim dessa decisão.
+//
+//   Um temporizador (SIGALRM) interrompe periodicamente a corrotina em
+//   execução e cada interrupção é um ponto de decisão: o escalonador
+//   volta a escolher a partir do instante real, pelo que uma chegada
+//   pode mudar de corrotina a meio de uma fatia. O sinal só levanta uma
+//   marca, que a corrotina verifica várias vezes por unidade de trabalho
+//   antes de devolver o controlo (trocar de contexto dentro do tratador
+//   não é seguro); a latência medida inclui o trabalho em curso.
+//   Fatias cujo tempo real já passou quando o dispatcher as recebe (por
+//   atrasos da máquina) ficam por executar, como num sistema real.
+//
+//   Só pode haver uma execução real de cada vez (o temporizador e o
+//   tratador do sinal são do processo).
+// ----------------------------------------------------------------
+
+#ifndef LIVE_H
+#define LIVE_H
+
+#include <stdbool.h>
+#include "process.h"
+#include "scheduler.h"
+#include "stats.h"
+
+typedef struct {
+    SchedulerType type;
+    int quantum;
+    SimTime max_time;          // Tempo total para as estatísticas (como nas outras simulações)
+    double unit_us;            // Tempo real de uma unidade de tempo simulado
+    int timer_us;              // Período do temporizador de preempção
+    int cpu;                   // CPU da thread (-1 = primeiro CPU permitido)
+} LiveConfig;
+
+typedef struct {
+    SimulationStats simulated;     // schedule() sobre uma cópia da carga (determinístico)
+    SimulationStats dispatched;    // Decisões tomadas com o relógio real
+    SimulationStats measured;      // Mesmos processos com os instantes medidos (em unidades)
+    long long slices;              // Fatias decididas com o relógio real
+    long long skipped_slices;      // Fatias cujo tempo real já tinha passado (não executadas)
+    SimTime skipped_units;
+    int cpu;                       // CPU onde a execução decorreu
+    long long unit_iterations;     // Iterações de trabalho calibradas por unidade
+    long long switches;            // Trocas de contexto (entrada e saída contam à parte)
+    double switch_ns;              // Custo médio de uma troca
+    long long preemptions;         // Devoluções forçadas pelo temporizador
+    double preempt_latency_ns;     // Média do sinal até o dispatcher retomar o controlo
+    double preempt_latency_max_ns;
+    SimTime makespan;              // Fim da última fatia simulada
+    double wall_seconds;           // Duração real da execução
+} LiveResult;
+
+LiveConfig default_live_config(void);
+
+// Executa a carga, que fica com os resultados das decisões tomadas. Como o
+// escalonador segue o tempo real, essas decisões variam de execução para
+// execução e diferem das de schedule() quando o dispatcher se atrasa (esse
+// tempo conta como CPU livre); por isso são comparadas com schedule()
+// sobre uma cópia da carga, e as fatias perdidas são contadas à parte.
+// Devolve false se não for possível preparar a thread, o CPU ou o temporizador.
+bool live_run(Process** processes, int count, const LiveConfig* config, LiveResult* result);
+
+void print_live_result(const LiveConfig* config, const LiveResult* result);
+
+#endif
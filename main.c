@@ -1,10 +1,30 @@
+#define _POSIX_C_SOURCE 200809L
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <string.h>
+#include <time.h>
 #include "process.h"
 #include "scheduler.h"
 #include "stats.h"
 #include "random_generator.h"
+#include "parallel.h"
+#include "replication.h"
+#include "sweep.h"
+#include "result_cache.h"
+#include "checkpoint.h"
+#include "incremental.h"
+#include "profile.h"
+#include "export.h"
+#include "live.h"
+#include "steady.h"
+
+// Número máximo de opções --what-if numa execução
+#define MAX_WHAT_IF_EDITS 64
+
+// Linhas da tabela de resultados no menu, salvo --rows (amostra uniforme)
+#define MENU_SCHEDULE_ROWS 50
 
 void print_menu() {
     printf("\nProbSched - Simulador de Escalonamento de CPU\n");
@@ -17,7 +37,9 @@ void print_menu() {
     printf("7. Executar Rate Monotonic (tempo real)\n");
     printf("8. Executar EDF (Earliest Deadline First)\n");
     printf("9. Mostrar estatísticas\n");
-    printf("10. Sair\n");
+    printf("10. Executar SRTF (Shortest Remaining Time First)\n");
+    printf("11. Executar HRRN (Highest Response Ratio Next)\n");
+    printf("12. Sair\n");
     printf("Escolha uma opção: ");
 }
 
@@ -29,16 +51,457 @@ void setup_real_time_processes(Process** processes, int count) {
     }
 }
 
-int main() {
-    init_random();
+void print_usage(const char* program) {
+    printf("Uso: %s [opções]\n", program);
+    printf("  --aging N    Envelhecimento de prioridades: sobe 1 nível a cada N unidades de espera\n");
+    printf("  --seed S     Seed da geração de processos (por omissão: relógio)\n");
+    printf("  --threads N  Número de threads (por omissão: nº de CPUs)\n");
+    printf("  --cache-dir D  Guarda os resultados do menu em disco (reutilizados entre execuções)\n");
+    printf("  --rows MODO  Tabela de resultados do menu: all, summary, top:K ou sample:K\n");
+    printf("               (por omissão sample:%d)\n", MENU_SCHEDULE_ROWS);
+    printf("  --help       Mostra esta ajuda\n");
+    printf("\nExecução não interativa:\n");
+    printf("  --algorithm A      fcfs, sjf, priority-np, priority-p, rr, rm, edf, srtf, hrrn\n");
+    printf("  --processes N      Número de processos por simulação\n");
+    printf("  --max-time T       Tempo máximo de simulação\n");
+    printf("  --quantum Q        Quantum para Round Robin\n");
+    printf("  --arrival D        Distribuição das chegadas (exponential, normal, uniform, poisson)\n");
+    printf("  --burst D          Distribuição dos tempos de execução\n");
+    printf("  --replications K   Replicações Monte Carlo (no máximo K) com intervalos de confiança\n");
+    printf("  --min-replications K\n");
+    printf("                     Replicações antes do primeiro teste de paragem (por omissão 10)\n");
+    printf("  --ci-target X      Meia-largura relativa pretendida (por omissão 0.05)\n");
+    printf("  --ci-absolute X    Meia-largura absoluta aceite para médias perto de zero (por omissão 0.01)\n");
+    printf("  --confidence C     Nível de confiança (por omissão 0.95)\n");
+    printf("  --rr-quanta LISTA  Curvas do Round Robin para vários quanta numa só passagem (ex.: 1..64)\n");
+    printf("  --sweep SPEC       Varrimento de parâmetros, por exemplo\n");
+    printf("                     \"algorithms=fcfs,rr;quantum=1..64;burst=normal,uniform;processes=1000\"\n");
+    printf("  --checkpoint F     Simula até --checkpoint-at T e grava o estado em F\n");
+    printf("  --checkpoint-at T  Instante do snapshot\n");
+    printf("  --resume F         Retoma o snapshot F (mesmas opções de carga) até ao fim\n");
+    printf("  --what-if EDIT     Re-simulação incremental de uma edição, por exemplo \"pid=12,burst=30\"\n");
+    printf("                     (campos: pid, arrival, burst, priority; pode repetir-se)\n");
+    printf("  --profile          Uma simulação com as estatísticas e os contadores internos em JSON\n");
+    printf("                     (os contadores exigem compilar com make PROFILE=1)\n");
+    printf("  --export F         Uma simulação com os resultados por processo em colunas binárias em F\n");
+    printf("  --steady N         Regime estacionário: corta o aquecimento (MSER-5) e estima por lotes\n");
+    printf("                     até atingir --ci-target ou --ci-absolute (no máximo N processos)\n");
+    printf("  --batches K        Número de lotes do regime estacionário (por omissão 30)\n");
+    printf("  --steady-load R    Carga oferecida do regime estacionário (por omissão 0.8;\n");
+    printf("                     0 = taxas das distribuições, normalmente acima de 1)\n");
+    printf("  --live U           Executa a carga em corrotinas reais, U µs por unidade de tempo,\n");
+    printf("                     e compara os tempos medidos com os simulados\n");
+    printf("  --live-timer T     Período do temporizador de preempção em µs (por omissão 1000)\n");
+    printf("  --live-cpu C       CPU onde a execução real decorre (por omissão o primeiro permitido)\n");
+    printf("\nSó pode ser pedido um modo de cada vez (--sweep, --rr-quanta, --what-if,\n");
+    printf("--checkpoint/--resume, --profile, --export, --steady, --live ou --replications).\n");
+}
+
+// Lê o valor de uma opção ou termina com erro se faltar
+static const char* option_value(int argc, char* argv[], int* i) {
+    if (*i + 1 >= argc) {
+        fprintf(stderr, "Falta o valor da opção %s\n", argv[*i]);
+        exit(EXIT_FAILURE);
+    }
+    return argv[++*i];
+}
+
+// Carga dos modos não interativos, gerada a partir das opções e da seed
+static Process** generate_workload(const ReplicationConfig* batch, int* count) {
+    Process** workload = (Process**)malloc(batch->process_count * sizeof(Process*));
+    if (workload == NULL) {
+        perror("Erro ao alocar memória");
+        exit(EXIT_FAILURE);
+    }
+    *count = generate_processes_parallel(workload, batch->process_count, batch->arrival_dist,
+                                         batch->burst_dist, batch->max_time, batch->seed);
+    return workload;
+}
+
+static void free_workload(Process** workload, int count) {
+    for (int i = 0; i < count; i++) {
+        free_process(workload[i]);
+    }
+    free(workload);
+}
+
+int main(int argc, char* argv[]) {
+    unsigned long long seed = (unsigned long long)time(NULL);
+    bool seed_given = false;
+    ReplicationConfig batch = default_replication_config();
+    bool replicate = false;
+    const char* sweep_spec = NULL;
+    const char* rr_quanta = NULL;
+    const char* cache_dir = NULL;
+    const char* checkpoint_path = NULL;
+    const char* resume_path = NULL;
+    SimTime checkpoint_at = -1;
+    ProcessEdit edits[MAX_WHAT_IF_EDITS];
+    int edit_count = 0;
+    bool profile = false;
+    const char* export_path = NULL;
+    bool live = false;
+    long long steady_jobs = 0;
+    int steady_batches = 30;
+    double steady_load = -1.0;
+    LiveConfig live_config = default_live_config();
+    ScheduleRows rows = SCHEDULE_ROWS_SAMPLE;
+    int row_limit = MENU_SCHEDULE_ROWS;
+
+    // Opções da linha de comandos
+    for (int i = 1; i < argc; i++) {
+        const char* option = argv[i];
+        if (strcmp(option, "--aging") == 0) {
+            set_priority_aging(atoi(option_value(argc, argv, &i)));
+        } else if (strcmp(option, "--seed") == 0) {
+            seed = strtoull(option_value(argc, argv, &i), NULL, 10);
+            seed_given = true;
+        } else if (strcmp(option, "--threads") == 0) {
+            parallel_set_thread_count(atoi(option_value(argc, argv, &i)));
+        } else if (strcmp(option, "--algorithm") == 0) {
+            const char* name = option_value(argc, argv, &i);
+            if (!scheduler_type_from_name(name, &batch.type)) {
+                fprintf(stderr, "Algoritmo desconhecido: %s\n", name);
+                return EXIT_FAILURE;
+            }
+        } else if (strcmp(option, "--processes") == 0) {
+            batch.process_count = atoi(option_value(argc, argv, &i));
+        } else if (strcmp(option, "--max-time") == 0) {
+            batch.max_time = atoll(option_value(argc, argv, &i));
+        } else if (strcmp(option, "--quantum") == 0) {
+            batch.quantum = atoi(option_value(argc, argv, &i));
+        } else if (strcmp(option, "--arrival") == 0 || strcmp(option, "--burst") == 0) {
+            const char* name = option_value(argc, argv, &i);
+            DistributionType* dist = strcmp(option, "--arrival") == 0 ? &batch.arrival_dist 
+                                                                       : &batch.burst_dist;
+            if (!distribution_from_name(name, dist)) {
+                fprintf(stderr, "Distribuição desconhecida: %s\n", name);
+                return EXIT_FAILURE;
+            }
+        } else if (strcmp(option, "--replications") == 0) {
+            batch.max_replications = atoi(option_value(argc, argv, &i));
+            replicate = true;
+        } else if (strcmp(option, "--min-replications") == 0) {
+            batch.min_replications = atoi(option_value(argc, argv, &i));
+        } else if (strcmp(option, "--ci-absolute") == 0) {
+            batch.absolute_precision = atof(option_value(argc, argv, &i));
+        } else if (strcmp(option, "--ci-target") == 0) {
+            batch.target_precision = atof(option_value(argc, argv, &i));
+        } else if (strcmp(option, "--confidence") == 0) {
+            batch.confidence = atof(option_value(argc, argv, &i));
+        } else if (strcmp(option, "--cache-dir") == 0) {
+            cache_dir = option_value(argc, argv, &i);
+        } else if (strcmp(option, "--rr-quanta") == 0) {
+            rr_quanta = option_value(argc, argv, &i);
+        } else if (strcmp(option, "--sweep") == 0) {
+            sweep_spec = option_value(argc, argv, &i);
+        } else if (strcmp(option, "--checkpoint") == 0) {
+            checkpoint_path = option_value(argc, argv, &i);
+        } else if (strcmp(option, "--checkpoint-at") == 0) {
+            checkpoint_at = atoll(option_value(argc, argv, &i));
+        } else if (strcmp(option, "--resume") == 0) {
+            resume_path = option_value(argc, argv, &i);
+        } else if (strcmp(option, "--what-if") == 0) {
+            const char* text = option_value(argc, argv, &i);
+            if (edit_count == MAX_WHAT_IF_EDITS || !parse_process_edit(text, &edits[edit_count])) {
+                fprintf(stderr, "Edição inválida: %s\n", text);
+                return EXIT_FAILURE;
+            }
+            edit_count++;
+        } else if (strcmp(option, "--rows") == 0) {
+            const char* text = option_value(argc, argv, &i);
+            if (!parse_schedule_rows(text, &rows, &row_limit)) {
+                fprintf(stderr, "Modo de tabela inválido: %s\n", text);
+                return EXIT_FAILURE;
+            }
+        } else if (strcmp(option, "--profile") == 0) {
+            profile = true;
+        } else if (strcmp(option, "--export") == 0) {
+            export_path = option_value(argc, argv, &i);
+        } else if (strcmp(option, "--steady") == 0) {
+            steady_jobs = atoll(option_value(argc, argv, &i));
+        } else if (strcmp(option, "--batches") == 0) {
+            steady_batches = atoi(option_value(argc, argv, &i));
+        } else if (strcmp(option, "--steady-load") == 0) {
+            steady_load = atof(option_value(argc, argv, &i));
+        } else if (strcmp(option, "--live") == 0) {
+            live_config.unit_us = atof(option_value(argc, argv, &i));
+            live = true;
+        } else if (strcmp(option, "--live-timer") == 0) {
+            live_config.timer_us = atoi(option_value(argc, argv, &i));
+        } else if (strcmp(option, "--live-cpu") == 0) {
+            live_config.cpu = atoi(option_value(argc, argv, &i));
+        } else if (strcmp(option, "--help") == 0) {
+            print_usage(argv[0]);
+            return 0;
+        } else {
+            fprintf(stderr, "Opção desconhecida: %s\n", option);
+            print_usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    batch.seed = seed;
+
+    // Cada modo corre sozinho: uma combinação é recusada em vez de ignorar
+    // silenciosamente os modos que viriam depois
+    const char* modes[9];
+    int mode_count = 0;
+    if (sweep_spec != NULL) modes[mode_count++] = "--sweep";
+    if (rr_quanta != NULL) modes[mode_count++] = "--rr-quanta";
+    if (edit_count > 0) modes[mode_count++] = "--what-if";
+    if (checkpoint_path != NULL || resume_path != NULL) {
+        modes[mode_count++] = checkpoint_path != NULL ? "--checkpoint" : "--resume";
+    }
+    if (profile) modes[mode_count++] = "--profile";
+    if (export_path != NULL) modes[mode_count++] = "--export";
+    if (steady_jobs != 0) modes[mode_count++] = "--steady";
+    if (live) modes[mode_count++] = "--live";
+    if (replicate) modes[mode_count++] = "--replications";
+    if (mode_count > 1) {
+        fprintf(stderr, "Modos incompatíveis:");
+        for (int m = 0; m < mode_count; m++) {
+            fprintf(stderr, " %s", modes[m]);
+        }
+        fprintf(stderr, " (escolha só um)\n");
+        return EXIT_FAILURE;
+    }
+
+    if (sweep_spec != NULL) {
+        SweepSpec spec;
+        if (!parse_sweep_spec(sweep_spec, &spec)) {
+            return EXIT_FAILURE;
+        }
+        run_sweep(&spec, parallel_thread_count(), stdout);
+        free_sweep_spec(&spec);
+        return 0;
+    }
+
+    if (rr_quanta != NULL) {
+        SweepList quanta = {0};
+        if (!parse_sweep_list(rr_quanta, &quanta, 1) || batch.process_count <= 0) {
+            fprintf(stderr, "Lista de quanta inválida: %s\n", rr_quanta);
+            return EXIT_FAILURE;
+        }
+        RRQuantumPoint* points = (RRQuantumPoint*)malloc(quanta.count * sizeof(RRQuantumPoint));
+        if (points == NULL) {
+            perror("Erro ao alocar memória");
+            return EXIT_FAILURE;
+        }
+        int count;
+        Process** workload = generate_workload(&batch, &count);
+        rr_quantum_sweep(workload, count, quanta.values, quanta.count, points);
+        print_rr_quantum_sweep(points, quanta.count);
+
+        free_workload(workload, count);
+        free(points);
+        free(quanta.values);
+        return 0;
+    }
+
+    if (edit_count > 0) {
+        if (batch.process_count <= 0) {
+            fprintf(stderr, "Número de processos tem de ser positivo\n");
+            return EXIT_FAILURE;
+        }
+        int count;
+        Process** workload = generate_workload(&batch, &count);
+        set_scheduler_verbose(false);
+
+        IncrementalRun* run = incremental_create(workload, count, batch.type, batch.quantum,
+                                                 batch.max_time, 32);
+        printf("Referência (%s, %d processos):", scheduler_type_name(batch.type), count);
+        print_stats(incremental_baseline_stats(run));
+
+        for (int e = 0; e < edit_count; e++) {
+            SimulationStats stats;
+            IncrementalInfo info;
+            struct timespec start, end;
+            clock_gettime(CLOCK_MONOTONIC, &start);
+            bool ok = incremental_evaluate(run, &edits[e], &stats, NULL, &info);
+            clock_gettime(CLOCK_MONOTONIC, &end);
+            if (!ok) {
+                fprintf(stderr, "\nEdição %d: processo %d inexistente ou valores inválidos\n", 
+                        e + 1, edits[e].pid);
+                continue;
+            }
+            double elapsed_ms = (end.tv_sec - start.tv_sec) * 1e3 + (end.tv_nsec - start.tv_nsec) / 1e6;
+            printf("\nEdição %d (PID %d): recomeço em t=%lld, ", e + 1, edits[e].pid, info.restart_time);
+            if (info.rejoin_time >= 0) {
+                printf("reencontro em t=%lld", info.rejoin_time);
+            } else {
+                printf("sem reencontro");
+            }
+            printf(", %.3f ms", elapsed_ms);
+            print_stats(stats);
+        }
+
+        incremental_destroy(run);
+        free_workload(workload, count);
+        return 0;
+    }
+
+    if (checkpoint_path != NULL || resume_path != NULL) {
+        if (batch.process_count <= 0 || (checkpoint_path != NULL && checkpoint_at < 0)) {
+            fprintf(stderr, "O snapshot precisa de --processes e de --checkpoint-at\n");
+            return EXIT_FAILURE;
+        }
+        // A carga é regenerada a partir das mesmas opções e seed
+        int count;
+        Process** workload = generate_workload(&batch, &count);
+        set_scheduler_verbose(false);
+
+        SchedulerState* state;
+        if (resume_path != NULL) {
+            state = checkpoint_load_file(resume_path, workload, count);
+            if (state == NULL) {
+                fprintf(stderr, "Snapshot inválido ou de outra carga: %s\n", resume_path);
+                return EXIT_FAILURE;
+            }
+            printf("Retomado em t=%lld\n", scheduler_current_time(state));
+        } else {
+            state = scheduler_begin(workload, count, batch.type, batch.quantum);
+        }
+
+        int status = 0;
+        if (checkpoint_path != NULL) {
+            scheduler_run_until(state, workload, checkpoint_at);
+            if (checkpoint_save_file(state, workload, checkpoint_path)) {
+                printf("Snapshot gravado em %s (t=%lld)\n", checkpoint_path, scheduler_current_time(state));
+            } else {
+                perror("Erro ao gravar o snapshot");
+                status = EXIT_FAILURE;
+            }
+        } else {
+            scheduler_run_until(state, workload, SIM_TIME_MAX);
+            print_stats(calculate_stats(workload, count, batch.max_time));
+        }
+
+        scheduler_state_free(state);
+        free_workload(workload, count);
+        return status;
+    }
+
+    if (profile) {
+        if (batch.process_count <= 0) {
+            fprintf(stderr, "Número de processos tem de ser positivo\n");
+            return EXIT_FAILURE;
+        }
+        set_scheduler_verbose(false);
+        profile_reset();
+
+        int count;
+        Process** workload = generate_workload(&batch, &count);
+        schedule(workload, count, batch.type, batch.quantum, batch.max_time);
+        SimulationStats stats = calculate_stats(workload, count, batch.max_time);
+        print_stats(stats);
+
+        ProfileCounters counters = profile_snapshot();
+        profile_print_json(stdout, scheduler_type_name(batch.type), count, stats, &counters);
+        if (!profile_enabled()) {
+            fprintf(stderr, "Contadores indisponíveis: compile com make PROFILE=1\n");
+        }
+
+        free_workload(workload, count);
+        return 0;
+    }
+
+    if (export_path != NULL) {
+        if (batch.process_count <= 0) {
+            fprintf(stderr, "Número de processos tem de ser positivo\n");
+            return EXIT_FAILURE;
+        }
+        set_scheduler_verbose(false);
+
+        int status = EXIT_SUCCESS;
+        int count;
+        Process** workload = generate_workload(&batch, &count);
+        SimulationStats stats;
+        if (export_simulation(export_path, workload, count, batch.type, batch.quantum,
+                              batch.max_time, &stats)) {
+            print_stats(stats);
+            printf("Resultados de %d processos exportados para %s\n", count, export_path);
+        } else {
+            perror("Erro ao exportar os resultados");
+            status = EXIT_FAILURE;
+        }
+
+        free_workload(workload, count);
+        return status;
+    }
+
+    if (steady_jobs != 0) {
+        SteadyConfig config = default_steady_config(&batch);
+        config.max_jobs = steady_jobs;
+        config.batches = steady_batches;
+        if (steady_load >= 0.0) config.load = steady_load;
+        set_scheduler_verbose(false);
+        SteadyResult result;
+        if (!run_steady_state(&config, &result)) {
+            fprintf(stderr, "Regime estacionário: precisa de N > 0, K >= 2, carga >= 0 e um algoritmo que não o Rate Monotonic\n");
+            return EXIT_FAILURE;
+        }
+        print_steady_result(&config, &result);
+        return 0;
+    }
+
+    if (live) {
+        if (batch.process_count <= 0 || live_config.unit_us <= 0 || live_config.timer_us <= 0) {
+            fprintf(stderr, "Número de processos, unidade de tempo e temporizador têm de ser positivos\n");
+            return EXIT_FAILURE;
+        }
+        set_scheduler_verbose(false);
+        live_config.type = batch.type;
+        live_config.quantum = batch.quantum;
+        live_config.max_time = batch.max_time;
+
+        int status = EXIT_SUCCESS;
+        int count;
+        Process** workload = generate_workload(&batch, &count);
+        LiveResult result;
+        if (live_run(workload, count, &live_config, &result)) {
+            print_live_result(&live_config, &result);
+        } else {
+            fprintf(stderr, "Não foi possível preparar a execução real (CPU %d)\n", live_config.cpu);
+            status = EXIT_FAILURE;
+        }
+
+        free_workload(workload, count);
+        return status;
+    }
+
+    if (replicate) {
+        if (batch.process_count <= 0 || batch.max_replications <= 0) {
+            fprintf(stderr, "Número de processos e de replicações tem de ser positivo\n");
+            return EXIT_FAILURE;
+        }
+        if (batch.min_replications < 2) {
+            fprintf(stderr, "São precisas pelo menos 2 replicações antes do teste de paragem\n");
+            return EXIT_FAILURE;
+        }
+        ReplicationResult result = run_replications(&batch);
+        print_replication_result(&batch, &result);
+        return 0;
+    }
+
+    if (seed_given) {
+        init_random_with_seed((unsigned int)seed);
+    } else {
+        init_random();
+    }
     
     Process** processes = NULL;
     int process_count = 0;
-    int max_time = 100;
+    SimTime max_time = 100;
     int quantum = 4;
     SimulationStats stats = {0};
     bool processes_generated = false;
     
+    // A tabela completa de uma carga grande demoraria mais do que a simulação
+    set_schedule_rows(rows, row_limit);
+
+    // Resultados repetidos (mesma carga e algoritmo) vêm da cache
+    ResultCache* cache = result_cache_create(32, (size_t)512 << 20, cache_dir);
+    
     int choice;
     do {
         print_menu();
@@ -46,11 +509,12 @@ int main() {
         
         switch(choice) {
             case 1: {
+                int requested_count;
                 printf("Número de processos a gerar: ");
-                scanf("%d", &process_count);
+                scanf("%d", &requested_count);
                 
                 printf("Tempo máximo de simulação: ");
-                scanf("%d", &max_time);
+                scanf("%lld", &max_time);
                 
                 printf("Quantum para Round Robin: ");
                 scanf("%d", &quantum);
@@ -63,14 +527,17 @@ int main() {
                     free(processes);
                 }
                 
-                processes = (Process**)malloc(process_count * sizeof(Process*));
+                processes = (Process**)malloc(requested_count * sizeof(Process*));
                 if (processes == NULL) {
                     perror("Erro ao alocar memória para processos");
                     exit(EXIT_FAILURE);
                 }
                 
                 // Gera processos com distribuição exponencial para chegada e normal para burst
-                generate_processes(processes, process_count, DIST_EXPONENTIAL, DIST_NORMAL, max_time);
+                // (em paralelo; cada geração usa uma seed nova derivada da inicial)
+                process_count = generate_processes_parallel(processes, requested_count, 
+                                                            DIST_EXPONENTIAL, DIST_NORMAL, 
+                                                            max_time, seed++);
                 
                 // Configura processos de tempo real
                 setup_real_time_processes(processes, process_count);
@@ -84,56 +551,49 @@ int main() {
                     printf("Gere processos primeiro!\n");
                     break;
                 }
-                schedule(processes, process_count, FCFS, quantum, max_time);
-                stats = calculate_stats(processes, process_count, max_time);
+                stats = schedule_cached(cache, processes, process_count, FCFS, quantum, max_time, NULL);
                 break;
             case 3:
                 if (!processes_generated) {
                     printf("Gere processos primeiro!\n");
                     break;
                 }
-                schedule(processes, process_count, SJF, quantum, max_time);
-                stats = calculate_stats(processes, process_count, max_time);
+                stats = schedule_cached(cache, processes, process_count, SJF, quantum, max_time, NULL);
                 break;
             case 4:
                 if (!processes_generated) {
                     printf("Gere processos primeiro!\n");
                     break;
                 }
-                schedule(processes, process_count, PRIORITY_NP, quantum, max_time);
-                stats = calculate_stats(processes, process_count, max_time);
+                stats = schedule_cached(cache, processes, process_count, PRIORITY_NP, quantum, max_time, NULL);
                 break;
             case 5:
                 if (!processes_generated) {
                     printf("Gere processos primeiro!\n");
                     break;
                 }
-                schedule(processes, process_count, PRIORITY_P, quantum, max_time);
-                stats = calculate_stats(processes, process_count, max_time);
+                stats = schedule_cached(cache, processes, process_count, PRIORITY_P, quantum, max_time, NULL);
                 break;
             case 6:
                 if (!processes_generated) {
                     printf("Gere processos primeiro!\n");
                     break;
                 }
-                schedule(processes, process_count, ROUND_ROBIN, quantum, max_time);
-                stats = calculate_stats(processes, process_count, max_time);
+                stats = schedule_cached(cache, processes, process_count, ROUND_ROBIN, quantum, max_time, NULL);
                 break;
             case 7:
                 if (!processes_generated) {
                     printf("Gere processos primeiro!\n");
                     break;
                 }
-                schedule(processes, process_count, RATE_MONOTONIC, quantum, max_time);
-                stats = calculate_stats(processes, process_count, max_time);
+                stats = schedule_cached(cache, processes, process_count, RATE_MONOTONIC, quantum, max_time, NULL);
                 break;
             case 8:
                 if (!processes_generated) {
                     printf("Gere processos primeiro!\n");
                     break;
                 }
-                schedule(processes, process_count, EDF, quantum, max_time);
-                stats = calculate_stats(processes, process_count, max_time);
+                stats = schedule_cached(cache, processes, process_count, EDF, quantum, max_time, NULL);
                 break;
             case 9:
                 if (!processes_generated) {
@@ -143,12 +603,26 @@ int main() {
                 print_stats(stats);
                 break;
             case 10:
+                if (!processes_generated) {
+                    printf("Gere processos primeiro!\n");
+                    break;
+                }
+                stats = schedule_cached(cache, processes, process_count, SRTF, quantum, max_time, NULL);
+                break;
+            case 11:
+                if (!processes_generated) {
+                    printf("Gere processos primeiro!\n");
+                    break;
+                }
+                stats = schedule_cached(cache, processes, process_count, HRRN, quantum, max_time, NULL);
+                break;
+            case 12:
                 printf("A sair...\n");
                 break;
             default:
                 printf("Opção inválida!\n");
         }
-    } while (choice != 10);
+    } while (choice != 12);
     
     // Libertação de memória
     if (processes != NULL) {
@@ -157,6 +631,7 @@ int main() {
         }
         free(processes);
     }
+    result_cache_destroy(cache);
     
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,83 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include "output.h"
+
+// Buffer de cada thread, alocado na primeira escrita e reaproveitado
+static _Thread_local char* thread_buffer = NULL;
+
+void output_open(OutputBuffer* out, int fd) {
+    if (thread_buffer == NULL) {
+        thread_buffer = (char*)malloc(OUTPUT_BUFFER_SIZE);
+        if (thread_buffer == NULL) {
+            perror("Erro ao alocar memória para a escrita");
+            exit(EXIT_FAILURE);
+        }
+    }
+    if (fd == STDOUT_FILENO) fflush(stdout);
+    out->fd = fd;
+    out->data = thread_buffer;
+    out->used = 0;
+    out->failed = false;
+}
+
+void output_flush(OutputBuffer* out) {
+    size_t written = 0;
+    while (written < out->used && !out->failed) {
+        ssize_t n = write(out->fd, out->data + written, out->used - written);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            out->failed = true;
+        } else {
+            written += (size_t)n;
+        }
+    }
+    out->used = 0;
+}
+
+bool output_close(OutputBuffer* out) {
+    output_flush(out);
+    out->data = NULL;
+    return !out->failed;
+}
+
+void output_bytes(OutputBuffer* out, const char* data, size_t length) {
+    if (length >= OUTPUT_BUFFER_SIZE) {
+        // Blocos maiores que o buffer seguem diretamente
+        output_flush(out);
+        char* saved = out->data;
+        out->data = (char*)data;
+        out->used = length;
+        output_flush(out);
+        out->data = saved;
+        return;
+    }
+    if (out->used + length > OUTPUT_BUFFER_SIZE) output_flush(out);
+    memcpy(out->data + out->used, data, length);
+    out->used += length;
+}
+
+void output_text(OutputBuffer* out, const char* text) {
+    output_bytes(out, text, strlen(text));
+}
+
+void output_int(OutputBuffer* out, long long value) {
+    // Dígitos gerados do fim para o início num buffer local
+    char digits[24];
+    int position = sizeof(digits);
+    unsigned long long magnitude = value < 0 ? 0ULL - (unsigned long long)value
+                                             : (unsigned long long)value;
+    do {
+        digits[--position] = (char)('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude > 0);
+    if (value < 0) digits[--position] = '-';
+
+    if (out->used + sizeof(digits) > OUTPUT_BUFFER_SIZE) output_flush(out);
+    memcpy(out->data + out->used, digits + position, sizeof(digits) - position);
+    out->used += sizeof(digits) - position;
+}
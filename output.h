@@ -0,0 +1,42 @@
+// ----------------------------------------------------------------
+//           Escrita de texto em bloco para tabelas grandes
+
+//   O texto é formatado num buffer grande e reutilizado (os inteiros
+//   são convertidos à mão, sem printf) e escrito com write(2) em
+//   blocos de OUTPUT_BUFFER_SIZE bytes. Cada thread tem o seu buffer;
+//   só pode haver uma escrita aberta de cada vez por thread.
+// ----------------------------------------------------------------
+
+#ifndef OUTPUT_H
+#define OUTPUT_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#define OUTPUT_BUFFER_SIZE (1 << 20)
+
+typedef struct {
+    int fd;
+    char* data;
+    size_t used;
+    bool failed;            // Alguma escrita falhou (o resto é descartado)
+} OutputBuffer;
+
+// Começa a escrever em 'fd'. Se for o descritor do stdout, o que o stdio
+// tem pendente é escrito primeiro para manter a ordem.
+void output_open(OutputBuffer* out, int fd);
+
+// Escreve o que falta; devolve false se alguma escrita falhou
+bool output_close(OutputBuffer* out);
+
+void output_flush(OutputBuffer* out);
+void output_bytes(OutputBuffer* out, const char* data, size_t length);
+void output_text(OutputBuffer* out, const char* text);
+void output_int(OutputBuffer* out, long long value);
+
+static inline void output_char(OutputBuffer* out, char c) {
+    if (out->used == OUTPUT_BUFFER_SIZE) output_flush(out);
+    out->data[out->used++] = c;
+}
+
+#endif
@@ -0,0 +1,192 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "parallel.h"
+#include "profile.h"
+
+static int configured_threads = 0;
+
+// Profundidade de tarefas paralelas em curso na thread atual
+static _Thread_local int worker_depth = 0;
+
+int parallel_thread_count(void) {
+    if (worker_depth > 0) {
+        return 1;
+    }
+    if (configured_threads > 0) {
+        return configured_threads;
+    }
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    return cpus > 0 ? (int)cpus : 1;
+}
+
+void parallel_set_thread_count(int threads) {
+    configured_threads = threads > 0 ? threads : 0;
+}
+
+void parallel_worker_begin(void) {
+    worker_depth++;
+}
+
+void parallel_worker_end(void) {
+    worker_depth--;
+    // Os contadores de instrumentação chegam ao processo antes do join
+    profile_flush_thread();
+}
+
+typedef struct {
+    atomic_int next_task;
+    int tasks;
+    void (*body)(int task, void* ctx);
+    void* ctx;
+} ParallelJob;
+
+static void* parallel_worker(void* arg) {
+    ParallelJob* job = (ParallelJob*)arg;
+    int task;
+    parallel_worker_begin();
+    while ((task = atomic_fetch_add(&job->next_task, 1)) < job->tasks) {
+        job->body(task, job->ctx);
+    }
+    parallel_worker_end();
+    return NULL;
+}
+
+void parallel_for(int tasks, int threads, void (*body)(int task, void* ctx), void* ctx) {
+    if (tasks <= 0) return;
+    if (threads > tasks) threads = tasks;
+
+    // Caso sequencial: evita criar threads
+    if (threads <= 1) {
+        for (int task = 0; task < tasks; task++) {
+            body(task, ctx);
+        }
+        return;
+    }
+
+    ParallelJob job;
+    atomic_init(&job.next_task, 0);
+    job.tasks = tasks;
+    job.body = body;
+    job.ctx = ctx;
+
+    pthread_t* workers = (pthread_t*)malloc((threads - 1) * sizeof(pthread_t));
+    if (workers == NULL) {
+        perror("Erro ao alocar memória para threads");
+        exit(EXIT_FAILURE);
+    }
+
+    int started = 0;
+    for (int t = 0; t < threads - 1; t++) {
+        if (pthread_create(&workers[t], NULL, parallel_worker, &job) != 0) {
+            break;  // Continua com as threads que foi possível criar
+        }
+        started++;
+    }
+
+    parallel_worker(&job);
+
+    for (int t = 0; t < started; t++) {
+        pthread_join(workers[t], NULL);
+    }
+    free(workers);
+}
+
+
+
+struct ParallelTeam {
+    pthread_mutex_t lock;
+    pthread_cond_t arrived;
+    int size;
+    int waiting;               // Threads paradas na barreira atual
+    unsigned generation;       // Muda cada vez que a barreira abre
+    void (*body)(ParallelTeam* team, int rank, void* ctx);
+    void* ctx;
+};
+
+typedef struct {
+    ParallelTeam* team;
+    int rank;
+} TeamMember;
+
+static void* team_worker(void* arg) {
+    TeamMember* member = (TeamMember*)arg;
+    ParallelTeam* team = member->team;
+
+    // O tamanho da equipa só fica fixo depois de criadas todas as threads
+    pthread_mutex_lock(&team->lock);
+    pthread_mutex_unlock(&team->lock);
+
+    parallel_worker_begin();
+    team->body(team, member->rank, team->ctx);
+    parallel_worker_end();
+    return NULL;
+}
+
+void parallel_team(int threads, void (*body)(ParallelTeam* team, int rank, void* ctx), void* ctx) {
+    ParallelTeam team;
+    pthread_mutex_init(&team.lock, NULL);
+    pthread_cond_init(&team.arrived, NULL);
+    team.size = 1;
+    team.waiting = 0;
+    team.generation = 0;
+    team.body = body;
+    team.ctx = ctx;
+
+    int extra = threads > 1 ? threads - 1 : 0;
+    pthread_t* workers = (pthread_t*)malloc((extra > 0 ? extra : 1) * sizeof(pthread_t));
+    TeamMember* members = (TeamMember*)malloc((extra > 0 ? extra : 1) * sizeof(TeamMember));
+    if (workers == NULL || members == NULL) {
+        perror("Erro ao alocar memória para threads");
+        exit(EXIT_FAILURE);
+    }
+
+    pthread_mutex_lock(&team.lock);
+    int started = 0;
+    for (int t = 0; t < extra; t++) {
+        members[t].team = &team;
+        members[t].rank = t + 1;
+        if (pthread_create(&workers[t], NULL, team_worker, &members[t]) != 0) {
+            break;  // A equipa fica com as threads que foi possível criar
+        }
+        started++;
+    }
+    team.size = started + 1;
+    pthread_mutex_unlock(&team.lock);
+
+    parallel_worker_begin();
+    body(&team, 0, ctx);
+    parallel_worker_end();
+
+    for (int t = 0; t < started; t++) {
+        pthread_join(workers[t], NULL);
+    }
+    free(workers);
+    free(members);
+    pthread_mutex_destroy(&team.lock);
+    pthread_cond_destroy(&team.arrived);
+}
+
+int parallel_team_size(const ParallelTeam* team) {
+    return team->size;
+}
+
+void parallel_team_barrier(ParallelTeam* team) {
+    if (team->size <= 1) return;
+    pthread_mutex_lock(&team->lock);
+    unsigned generation = team->generation;
+    if (++team->waiting == team->size) {
+        team->waiting = 0;
+        team->generation++;
+        pthread_cond_broadcast(&team->arrived);
+    } else {
+        while (generation == team->generation) {
+            pthread_cond_wait(&team->arrived, &team->lock);
+        }
+    }
+    pthread_mutex_unlock(&team->lock);
+}
@@ -0,0 +1,42 @@
+// ----------------------------------------------------------------
+//        Utilitários de paralelismo (pthreads) do simulador
+
+//   Distribui tarefas independentes por um conjunto de threads
+// ----------------------------------------------------------------
+
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+// Número de threads a usar (configurado ou nº de CPUs disponíveis).
+// Dentro de uma tarefa paralela devolve 1: o paralelismo aninhado (por
+// exemplo gerar e ordenar dentro de uma replicação) corre na própria
+// thread em vez de criar T threads em cada uma das T threads.
+int parallel_thread_count(void);
+
+// Define o número de threads (0 = automático)
+void parallel_set_thread_count(int threads);
+
+// Marca a thread atual como trabalhadora de um conjunto paralelo (pares
+// begin/end, podem aninhar). Usado por parallel_for, parallel_team e pelo
+// pool de threads.
+void parallel_worker_begin(void);
+void parallel_worker_end(void);
+
+// Executa body(task, ctx) para task = 0..tasks-1 usando até 'threads' threads.
+// As tarefas são distribuídas dinamicamente; a thread que chama também trabalha.
+void parallel_for(int tasks, int threads, void (*body)(int task, void* ctx), void* ctx);
+
+// Equipa de threads para trabalho em fases (as mesmas threads do princípio
+// ao fim, separadas por barreiras em vez de um parallel_for por fase)
+typedef struct ParallelTeam ParallelTeam;
+
+// Executa body(team, rank, ctx) uma vez em cada thread da equipa, com
+// rank = 0..size-1 (a thread que chama é o rank 0). A equipa tem até
+// 'threads' threads; o tamanho real é dado por parallel_team_size.
+void parallel_team(int threads, void (*body)(ParallelTeam* team, int rank, void* ctx), void* ctx);
+int parallel_team_size(const ParallelTeam* team);
+
+// Espera que todas as threads da equipa cheguem a este ponto
+void parallel_team_barrier(ParallelTeam* team);
+
+#endif
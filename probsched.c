@@ -0,0 +1,173 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include "probsched.h"
+#include "scheduler_state.h"
+#include "heap.h"
+
+// Os processos vivem em blocos de tamanho fixo para que os endereços
+// não mudem quando o motor cresce
+#define PROBSCHED_BLOCK_SIZE 1024
+
+// Os jobs terminados são retirados quando são pelo menos metade das
+// posições (e já ocupam um bloco): cada compactação custa O(N) e retira
+// pelo menos N/2 jobs, o que dá custo amortizado constante por job
+#define PROBSCHED_COMPACT_MIN PROBSCHED_BLOCK_SIZE
+
+struct ProbSchedEngine {
+    SchedulerType policy;
+    SchedulerState* state;
+    Process** processes;       // Por ordem de submissão (= ordem de chegada)
+    int capacity;
+    Process** blocks;
+    int block_count;
+    SimTime horizon;           // Decisões anteriores a este instante já foram tomadas
+    SimTime last_arrival;
+};
+
+static void* engine_alloc(void* pointer, size_t size) {
+    pointer = realloc(pointer, size);
+    if (pointer == NULL) {
+        perror("Erro ao alocar memória para o motor de escalonamento");
+        exit(EXIT_FAILURE);
+    }
+    return pointer;
+}
+
+ProbSchedEngine* probsched_create(SchedulerType policy, int quantum, int aging_interval) {
+    if ((int)policy < FCFS || policy > HRRN) return NULL;
+
+    ProbSchedEngine* engine = (ProbSchedEngine*)engine_alloc(NULL, sizeof(ProbSchedEngine));
+    memset(engine, 0, sizeof(ProbSchedEngine));
+    engine->policy = policy;
+
+    // Rate Monotonic: prioridade fixa preemptiva, a chave é o período
+    SchedulerType type = policy == RATE_MONOTONIC ? PRIORITY_P : policy;
+    if (policy == RATE_MONOTONIC) aging_interval = 0;
+    SchedulerState* s = scheduler_state_create(NULL, 0, type, quantum, aging_interval);
+    scheduler_state_record(s, true);
+    engine->state = s;
+    return engine;
+}
+
+void probsched_destroy(ProbSchedEngine* engine) {
+    if (engine == NULL) return;
+    for (int b = 0; b < engine->block_count; b++) {
+        free(engine->blocks[b]);
+    }
+    free(engine->blocks);
+    free(engine->processes);
+    scheduler_state_free(engine->state);
+    free(engine);
+}
+
+static Process* new_process(ProbSchedEngine* engine) {
+    int count = engine->state->count;
+    if (count == engine->capacity) {
+        engine->capacity = engine->capacity ? engine->capacity * 2 : PROBSCHED_BLOCK_SIZE;
+        engine->processes = (Process**)engine_alloc(engine->processes,
+                                                    engine->capacity * sizeof(Process*));
+    }
+    if (count == engine->block_count * PROBSCHED_BLOCK_SIZE) {
+        engine->blocks = (Process**)engine_alloc(engine->blocks,
+                                                 (engine->block_count + 1) * sizeof(Process*));
+        engine->blocks[engine->block_count++] =
+            (Process*)engine_alloc(NULL, PROBSCHED_BLOCK_SIZE * sizeof(Process));
+    }
+    Process* p = &engine->blocks[count / PROBSCHED_BLOCK_SIZE][count % PROBSCHED_BLOCK_SIZE];
+    engine->processes[count] = p;
+    return p;
+}
+
+bool probsched_submit(ProbSchedEngine* engine, const ProbSchedJob* job) {
+    if (job->burst_time <= 0 || job->deadline < 0 || job->arrival_time < 0 ||
+        job->arrival_time < engine->horizon || job->arrival_time < engine->last_arrival ||
+        job->burst_time > SIM_TIME_MAX - job->arrival_time) {
+        return false;
+    }
+    // No Rate Monotonic o período é a prioridade do job
+    if (engine->policy == RATE_MONOTONIC && (job->period <= 0 || job->period > INT_MAX)) return false;
+
+    Process* p = new_process(engine);
+    memset(p, 0, sizeof(Process));
+    p->pid = job->id;
+    p->arrival_time = job->arrival_time;
+    p->burst_time = job->burst_time;
+    p->remaining_time = job->burst_time;
+    p->priority = job->priority;
+    p->period = job->period;
+    p->deadline = job->deadline;
+    p->first_run_time = -1;
+    p->original_deadline = job->deadline;
+
+    if (engine->policy == RATE_MONOTONIC) {
+        p->priority = (int)job->period;
+        if (p->deadline == 0) p->deadline = job->period;
+    } else if (engine->policy == EDF && p->deadline == 0) {
+        // Sem deadline: fica depois de todos os que a têm
+        p->deadline = SIM_TIME_MAX - p->arrival_time;
+    }
+    // Deadlines para lá do maior instante representável ficam nesse instante
+    if (p->deadline > SIM_TIME_MAX - p->arrival_time) {
+        p->deadline = SIM_TIME_MAX - p->arrival_time;
+    }
+
+    scheduler_state_append(engine->state, engine->processes);
+    engine->last_arrival = job->arrival_time;
+    return true;
+}
+
+// Retira os jobs terminados: os restantes passam para blocos novos, pela
+// mesma ordem, e os blocos antigos são libertados
+static void compact(ProbSchedEngine* engine) {
+    SchedulerState* s = engine->state;
+    if (s->count < PROBSCHED_COMPACT_MIN || 2 * s->completed < s->count) return;
+    if (scheduler_state_compact(s, engine->processes) == 0) return;
+
+    int count = s->count;
+    int block_count = (count + PROBSCHED_BLOCK_SIZE - 1) / PROBSCHED_BLOCK_SIZE;
+    Process** blocks = (Process**)engine_alloc(NULL, (block_count > 0 ? block_count : 1) *
+                                                     sizeof(Process*));
+    for (int b = 0; b < block_count; b++) {
+        blocks[b] = (Process*)engine_alloc(NULL, PROBSCHED_BLOCK_SIZE * sizeof(Process));
+    }
+    for (int i = 0; i < count; i++) {
+        Process* p = &blocks[i / PROBSCHED_BLOCK_SIZE][i % PROBSCHED_BLOCK_SIZE];
+        *p = *engine->processes[i];
+        engine->processes[i] = p;
+    }
+    for (int b = 0; b < engine->block_count; b++) {
+        free(engine->blocks[b]);
+    }
+    free(engine->blocks);
+    engine->blocks = blocks;
+    engine->block_count = block_count;
+}
+
+void probsched_advance_to(ProbSchedEngine* engine, SimTime time) {
+    if (time <= engine->horizon) return;
+    engine->horizon = time;
+    compact(engine);
+    scheduler_run_until(engine->state, engine->processes, time);
+}
+
+bool probsched_next_dispatch(ProbSchedEngine* engine, ProbSchedDispatch* dispatch) {
+    SchedulerEvent event;
+    if (!scheduler_next_event(engine->state, &event)) return false;
+
+    dispatch->type = event.type == SCHED_EVENT_MISS ? PROBSCHED_DEADLINE_MISS : PROBSCHED_RUN;
+    dispatch->job_id = engine->processes[event.index]->pid;
+    dispatch->start_time = event.start;
+    dispatch->duration = event.length;
+    dispatch->completed = event.completed;
+    return true;
+}
+
+SimTime probsched_horizon(const ProbSchedEngine* engine) {
+    return engine->horizon;
+}
+
+int probsched_pending(const ProbSchedEngine* engine) {
+    return engine->state->count - engine->state->completed;
+}
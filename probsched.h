@@ -0,0 +1,87 @@
+// ----------------------------------------------------------------
+//       libprobsched: motor de escalonamento online embebível
+
+//   Os mesmos algoritmos do simulador, mas alimentados job a job por
+//   quem os embebe: submete-se cada job à medida que chega, avança-se o
+//   relógio e consomem-se as decisões tomadas. Cada motor é
+//   independente (sem estado global nem escrita no terminal), pelo que
+//   vários podem correr em threads diferentes, cada um com o seu
+//   envelhecimento. O resto da biblioteca (schedule(), print_schedule()
+//   e os set_* de scheduler.h) partilha uma configuração global do
+//   processo e não é reentrante.
+//
+//       ProbSchedEngine* e = probsched_create(SRTF, 0, 0);
+//       probsched_submit(e, &job);             // job.arrival_time >= horizonte
+//       probsched_advance_to(e, t);
+//       ProbSchedDispatch d;
+//       while (probsched_next_dispatch(e, &d)) { ... }
+//       probsched_destroy(e);
+//
+//   Custo por operação, com N jobs em espera:
+//       FCFS, Round Robin                      O(1)
+//       SJF, SRTF, prioridades, RM e EDF       O(log N)
+//       HRRN                                   O(B) por decisão
+//   No HRRN, B é o número de bursts distintos em espera. É pequeno quando
+//   os bursts se repetem (como nas distribuições do gerador), mas com
+//   bursts todos distintos B = N e cada decisão custa O(N).
+// ----------------------------------------------------------------
+
+#ifndef PROBSCHED_H
+#define PROBSCHED_H
+
+#include <stdbool.h>
+#include "scheduler.h"
+
+typedef struct ProbSchedEngine ProbSchedEngine;
+
+// Os tempos são SimTime (64 bits)
+typedef struct {
+    int id;                // Identificador escolhido por quem submete
+    SimTime arrival_time;  // Não anterior ao horizonte nem à chegada anterior
+    SimTime burst_time;    // > 0
+    int priority;          // Menor = mais urgente; 0 = tempo real
+    SimTime deadline;      // Relativa à chegada (0 = sem deadline)
+    SimTime period;        // Rate Monotonic: período (prioridade fixa, até INT_MAX)
+} ProbSchedJob;
+
+typedef enum {
+    PROBSCHED_RUN,             // O job executa de start_time durante duration
+    PROBSCHED_DEADLINE_MISS    // O job foi descartado por deadline perdida
+} ProbSchedEventType;
+
+typedef struct {
+    ProbSchedEventType type;
+    int job_id;
+    SimTime start_time;
+    SimTime duration;      // 0 nas deadlines perdidas
+    bool completed;        // O job termina no fim desta fatia
+} ProbSchedDispatch;
+
+// Motor vazio no instante 0. O Rate Monotonic é feito como prioridade
+// fixa preemptiva pelo período: cada ativação é submetida como um job,
+// com deadline implícita igual ao período.
+ProbSchedEngine* probsched_create(SchedulerType policy, int quantum, int aging_interval);
+void probsched_destroy(ProbSchedEngine* engine);
+
+// Acrescenta um job. Devolve false (sem efeito) se for inválido ou chegar
+// antes do horizonte ou do último job submetido.
+bool probsched_submit(ProbSchedEngine* engine, const ProbSchedJob* job);
+
+// Toma todas as decisões anteriores a 'time', que passa a ser o horizonte.
+// Um job não-preemptivo já iniciado pode terminar depois do horizonte.
+// Antes disso retira os jobs terminados se já forem metade dos guardados
+// e todas as decisões tiverem sido consumidas: a memória fica limitada
+// pelo maior número de jobs por terminar (ou por consumir), não pelo
+// total submetido.
+void probsched_advance_to(ProbSchedEngine* engine, SimTime time);
+
+// Próxima decisão tomada e ainda não consumida, por ordem cronológica;
+// fatias seguidas do mesmo job são entregues juntas. false se não houver.
+bool probsched_next_dispatch(ProbSchedEngine* engine, ProbSchedDispatch* dispatch);
+
+SimTime probsched_horizon(const ProbSchedEngine* engine);
+
+// Jobs submetidos que ainda não terminaram (nem foram descartados)
+int probsched_pending(const ProbSchedEngine* engine);
+
+#endif
@@ -3,8 +3,11 @@
 #include <string.h>
 #include "process.h"
 #include "random_generator.h"
+#include "parallel.h"
+#include "profile.h"
 
-Process* create_process(int pid, int arrival, int burst, int priority) {
+Process* create_process(int pid, SimTime arrival, SimTime burst, int priority) {
+    PROFILE_COUNT(allocations, 1);
     Process* p = (Process*)malloc(sizeof(Process));
     if (p == NULL) {
         perror("Erro ao alocar memória para processo");
@@ -22,7 +25,6 @@ Process* create_process(int pid, int arrival, int burst, int priority) {
     p->first_run_time = -1;
     p->missed_deadline = false;
     p->deadline_miss_count = 0;
-    p->original_period = 0;
     p->original_deadline = 0;
 
     return p;
@@ -31,10 +33,11 @@ Process* create_process(int pid, int arrival, int burst, int priority) {
 void generate_processes(Process** processes, int count, 
                        DistributionType arrival_dist, 
                        DistributionType burst_dist, 
-                       int max_time) {
+                       SimTime max_time) {
     if (count <= 0 || processes == NULL) return;
+    PROFILE_PHASE_BEGIN();
 
-    int arrival_time = 0;
+    SimTime arrival_time = 0;
     const int real_time_probability = 20; // 20% chance de ser processo de tempo real
 
     for (int i = 0; i < count; i++) {
@@ -56,7 +59,7 @@ void generate_processes(Process** processes, int count,
         }
 
         // Gera tempo de execução
-        int burst_time;
+        int burst_time = 1;
         switch(burst_dist) {
             case DIST_EXPONENTIAL:
                 burst_time = (int)(exponential_random(0.3) + 1);
@@ -88,11 +91,203 @@ void generate_processes(Process** processes, int count,
             break;
         }
     }
+    PROFILE_PHASE_END(PROFILE_GENERATE);
+}
+
+// ----------------------------------------------------------------
+//                  Geração paralela de processos
+// ----------------------------------------------------------------
+
+// Cada bloco de processos tem o seu próprio stream aleatório, identificado
+// pelo número do bloco; o resultado não depende do número de threads
+#define GENERATION_CHUNK 65536
+
+typedef struct {
+    Process** processes;
+    int count;
+    DistributionType arrival_dist;
+    DistributionType burst_dist;
+    unsigned long long seed;
+    SimTime* chunk_offset;     // Soma dos intervalos de cada bloco (depois: prefixo)
+} ParallelGeneration;
+
+static int sample_arrival_gap(RandomStream* stream, DistributionType dist) {
+    int gap = 0;
+    switch (dist) {
+        case DIST_EXPONENTIAL:
+            gap = (int)(stream_exponential(stream, 0.5) + 1);
+            break;
+        case DIST_NORMAL:
+            gap = (int)(stream_normal(stream, 5, 2) + 1);
+            break;
+        case DIST_UNIFORM:
+            gap = stream_uniform_int(stream, 1, 10);
+            break;
+        case DIST_POISSON:
+            gap = stream_poisson(stream, 3);
+            break;
+    }
+    return gap > 0 ? gap : 0;  // Chegadas nunca recuam no tempo
+}
+
+static int sample_burst(RandomStream* stream, DistributionType dist) {
+    int burst = 1;
+    switch (dist) {
+        case DIST_EXPONENTIAL:
+            burst = (int)(stream_exponential(stream, 0.3) + 1);
+            break;
+        case DIST_NORMAL:
+            burst = (int)(stream_normal(stream, 8, 3) + 1);
+            break;
+        case DIST_UNIFORM:
+            burst = stream_uniform_int(stream, 1, 15);
+            break;
+        case DIST_POISSON:
+            burst = stream_poisson(stream, 5) + 1;
+            break;
+    }
+    return burst > 0 ? burst : 1;  // Um processo precisa de pelo menos 1 unidade
+}
+
+// Sorteia o processo seguinte de um stream; a chegada soma-se a *time.
+// A deadline absoluta fica por calcular (depende do deslocamento do bloco).
+static void sample_process(RandomStream* stream, DistributionType arrival_dist,
+                           DistributionType burst_dist, SimTime* time, Process* p) {
+    const int real_time_probability = 20; // 20% chance de ser processo de tempo real
+    const int weights[10] = {10, 9, 8, 7, 6, 5, 4, 3, 2, 1};
+
+    *time += sample_arrival_gap(stream, arrival_dist);
+    p->arrival_time = *time;
+    p->burst_time = sample_burst(stream, burst_dist);
+    p->remaining_time = p->burst_time;
+    p->priority = stream_weighted(stream, weights, 10) + 1;
+
+    if (stream_uniform_int(stream, 1, 100) <= real_time_probability) {
+        int period = stream_uniform_int(stream, 20, 50);
+        p->period = period;
+        p->original_deadline = period;
+        p->priority = 0;
+    }
+}
+
+// Fase 1: cada bloco gera os seus processos com chegadas relativas ao início do bloco
+static void generate_chunk(int chunk, void* ctx) {
+    ParallelGeneration* gen = (ParallelGeneration*)ctx;
+    int begin = chunk * GENERATION_CHUNK;
+    int end = begin + GENERATION_CHUNK < gen->count ? begin + GENERATION_CHUNK : gen->count;
+
+    RandomStream stream;
+    stream_init(&stream, gen->seed, (unsigned long long)chunk);
+
+    SimTime local_time = 0;
+    for (int i = begin; i < end; i++) {
+        gen->processes[i] = create_process(i + 1, 0, 1, 0);
+        sample_process(&stream, gen->arrival_dist, gen->burst_dist, &local_time, gen->processes[i]);
+    }
+    gen->chunk_offset[chunk] = local_time;
+}
+
+// Fase 3: soma o prefixo dos blocos anteriores às chegadas do bloco
+static void offset_chunk(int chunk, void* ctx) {
+    ParallelGeneration* gen = (ParallelGeneration*)ctx;
+    int begin = chunk * GENERATION_CHUNK;
+    int end = begin + GENERATION_CHUNK < gen->count ? begin + GENERATION_CHUNK : gen->count;
+    SimTime offset = gen->chunk_offset[chunk];
+
+    for (int i = begin; i < end; i++) {
+        Process* p = gen->processes[i];
+        p->arrival_time += offset;
+        if (p->original_deadline > 0) {
+            p->deadline = p->arrival_time + p->original_deadline; // Deadline absoluto
+        }
+    }
+}
+
+int generate_processes_parallel(Process** processes, int count,
+                                DistributionType arrival_dist,
+                                DistributionType burst_dist,
+                                SimTime max_time, unsigned long long seed) {
+    if (count <= 0 || processes == NULL) return 0;
+    PROFILE_PHASE_BEGIN();
+
+    int chunks = (count + GENERATION_CHUNK - 1) / GENERATION_CHUNK;
+    ParallelGeneration gen;
+    gen.processes = processes;
+    gen.count = count;
+    gen.arrival_dist = arrival_dist;
+    gen.burst_dist = burst_dist;
+    gen.seed = seed;
+    gen.chunk_offset = (SimTime*)malloc(chunks * sizeof(SimTime));
+    if (gen.chunk_offset == NULL) {
+        perror("Erro ao alocar memória para geração de processos");
+        exit(EXIT_FAILURE);
+    }
+
+    int threads = parallel_thread_count();
+    parallel_for(chunks, threads, generate_chunk, &gen);
+
+    // Fase 2: prefixo exclusivo das somas dos blocos
+    SimTime prefix = 0;
+    for (int c = 0; c < chunks; c++) {
+        SimTime chunk_total = gen.chunk_offset[c];
+        gen.chunk_offset[c] = prefix;
+        prefix += chunk_total;
+    }
+
+    parallel_for(chunks, threads, offset_chunk, &gen);
+    free(gen.chunk_offset);
+
+    // Tal como na versão sequencial, pára no primeiro processo que chega
+    // depois de max_time (inclusive); as chegadas são crescentes
+    int low = 0, high = count;
+    while (low < high) {
+        int mid = low + (high - low) / 2;
+        if (processes[mid]->arrival_time > max_time) high = mid;
+        else low = mid + 1;
+    }
+    int generated = low < count ? low + 1 : count;
+    for (int i = generated; i < count; i++) {
+        free_process(processes[i]);
+        processes[i] = NULL;
+    }
+
+    PROFILE_PHASE_END(PROFILE_GENERATE);
+    return generated;
+}
+
+void process_stream_init(ProcessStream* source, DistributionType arrival_dist,
+                         DistributionType burst_dist, unsigned long long seed,
+                         double arrival_scale) {
+    stream_init(&source->stream, seed, 0);
+    source->arrival_dist = arrival_dist;
+    source->burst_dist = burst_dist;
+    source->arrival_scale = arrival_scale > 0.0 ? arrival_scale : 1.0;
+    source->clock = 0.0;
+    source->time = 0;
+    source->next_pid = 1;
+}
+
+void process_stream_next(ProcessStream* source, Process* p) {
+    memset(p, 0, sizeof(Process));
+    p->pid = source->next_pid++;
+    p->first_run_time = -1;
+
+    // O intervalo sorteado é escalado sobre o relógio exato, para que o
+    // truncamento não acumule erro; as chegadas continuam não decrescentes
+    SimTime gap = 0;
+    sample_process(&source->stream, source->arrival_dist, source->burst_dist, &gap, p);
+    source->clock += (double)gap * source->arrival_scale;
+    source->time = (SimTime)source->clock;
+    p->arrival_time = source->time;
+    if (p->original_deadline > 0) {
+        p->deadline = p->arrival_time + p->original_deadline;
+    }
 }
 
 Process* clone_process(const Process* source) {
     if (source == NULL) return NULL;
 
+    PROFILE_COUNT(allocations, 1);
     Process* clone = (Process*)malloc(sizeof(Process));
     if (clone == NULL) {
         perror("Erro ao alocar memória para clone de processo");
@@ -105,12 +300,11 @@ Process* clone_process(const Process* source) {
 }
 
 
-void setup_real_time_attributes(Process* process, int period, int deadline) {
+void setup_real_time_attributes(Process* process, SimTime period, SimTime deadline) {
     if (process == NULL) return;
     
     process->period = period;
     process->deadline = process->arrival_time + deadline; // Deadline absoluto
-    process->original_period = period;
     process->original_deadline = deadline;
     process->priority = 0; // Máxima prioridade para tempo real
 }
@@ -119,4 +313,21 @@ void free_process(Process* process) {
     if (process != NULL) {
         free(process);
     }
-}
\ No newline at end of file
+}
+
+static const char* distribution_names[] = { "exponential", "normal", "uniform", "poisson" };
+
+const char* distribution_name(DistributionType dist) {
+    if ((int)dist < 0 || (int)dist > DIST_POISSON) return "?";
+    return distribution_names[dist];
+}
+
+bool distribution_from_name(const char* name, DistributionType* dist) {
+    for (int i = 0; i <= DIST_POISSON; i++) {
+        if (strcmp(name, distribution_names[i]) == 0) {
+            *dist = (DistributionType)i;
+            return true;
+        }
+    }
+    return false;
+}
@@ -6,6 +6,8 @@
 #define PROCESS_H
 
 #include <stdbool.h>
+#include <limits.h>
+#include "random_generator.h"
 
 // Tipos de distribuição para geração de processos
 typedef enum {
@@ -15,34 +17,70 @@ typedef enum {
     DIST_POISSON       // Distribuição de Poisson
 } DistributionType;
 
-// Estrutura que representa um processo
+// Tempo simulado e durações. Com 64 bits os horizontes podem passar
+// largamente 2^31 unidades sem transbordar.
+typedef long long SimTime;
+#define SIM_TIME_MAX LLONG_MAX
+
+// Estrutura que representa um processo (campos de 64 bits primeiro,
+// para não haver preenchimento entre campos)
 typedef struct {
-    int pid;               // Identificador único do processo
-    int arrival_time;      // Tempo de chegada do processo
-    int burst_time;        // Tempo total de execução necessário
-    int remaining_time;    // Tempo restante de execução
-    int priority;          // Prioridade do processo (1-10)
-    int period;            // Período para processos periódicos (tempo real)
-    int deadline;          // Deadline absoluta (tempo real)
-    int completion_time;   // Tempo de conclusão do processo
-    int first_run_time;    // Tempo da primeira execução (para cálculo de tempo de resposta)
-    bool missed_deadline;  // Indica se o processo perdeu o deadline
-    int deadline_miss_count; // Contador de deadlines perdidos
-    int original_period;   // Período original (para reinicialização)
-    int original_deadline; // Deadline original 
+    SimTime arrival_time;      // Tempo de chegada do processo
+    SimTime burst_time;        // Tempo total de execução necessário
+    SimTime remaining_time;    // Tempo restante de execução
+    SimTime period;            // Período para processos periódicos (tempo real)
+    SimTime deadline;          // Deadline absoluta (tempo real)
+    SimTime completion_time;   // Tempo de conclusão do processo
+    SimTime first_run_time;    // Tempo da primeira execução (para cálculo de tempo de resposta)
+    SimTime original_deadline; // Deadline relativa original
+    int pid;                   // Identificador único do processo
+    int priority;              // Prioridade do processo (1-10)
+    int deadline_miss_count;   // Contador de deadlines perdidos
+    bool missed_deadline;      // Indica se o processo perdeu o deadline
 } Process;
 
 // Cria um novo processo com os parâmetros especificados
-Process* create_process(int pid, int arrival, int burst, int priority);
+Process* create_process(int pid, SimTime arrival, SimTime burst, int priority);
 
 // Gera um conjunto de processos com propriedades aleatórias
 void generate_processes(Process** processes, int count, 
                        DistributionType arrival_dist, 
                        DistributionType burst_dist, 
-                       int max_time);
+                       SimTime max_time);
+
+// Versão paralela e determinística: cada bloco de processos usa um stream
+// próprio derivado da seed e as chegadas absolutas resultam de uma soma de
+// prefixos. O resultado só depende da seed (não do número de threads).
+// Devolve o número de processos efetivamente gerados (limitado por max_time).
+int generate_processes_parallel(Process** processes, int count,
+                                DistributionType arrival_dist,
+                                DistributionType burst_dist,
+                                SimTime max_time, unsigned long long seed);
+
+// Gerador sequencial sem fim (sistema aberto): as mesmas distribuições
+// de generate_processes_parallel, um processo de cada vez e sem limite
+// de tempo. O resultado só depende da seed. Os intervalos entre chegadas
+// são multiplicados por arrival_scale (1 = sem alteração; > 1 baixa a
+// taxa de chegada e portanto a carga oferecida).
+typedef struct {
+    RandomStream stream;
+    DistributionType arrival_dist;
+    DistributionType burst_dist;
+    double arrival_scale;
+    double clock;              // Instante exato da última chegada (antes de truncar)
+    SimTime time;              // Chegada do último processo gerado
+    int next_pid;
+} ProcessStream;
+
+void process_stream_init(ProcessStream* source, DistributionType arrival_dist,
+                         DistributionType burst_dist, unsigned long long seed,
+                         double arrival_scale);
+
+// Preenche *process com o processo seguinte (chegadas não decrescentes)
+void process_stream_next(ProcessStream* source, Process* process);
 
 // Configura parâmetros de tempo real para um processo
-void setup_real_time_attributes(Process* process, int period, int deadline);
+void setup_real_time_attributes(Process* process, SimTime period, SimTime deadline);
 
 // Função para clonar um processo (útil para comparação de algoritmos)
 Process* clone_process(const Process* source);
@@ -50,4 +88,8 @@ Process* clone_process(const Process* source);
 // Libera a memória alocada para um processo
 void free_process(Process* process);
 
+// Nome da distribuição ("exponential", "normal", ...) e conversão inversa
+const char* distribution_name(DistributionType dist);
+bool distribution_from_name(const char* name, DistributionType* dist);
+
 #endif
\ No newline at end of file
@@ -0,0 +1,126 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include "profile.h"
+
+static const char* phase_names[PROFILE_PHASE_COUNT] = {
+    "generate", "sort", "simulate", "stats", "output"
+};
+
+#ifdef PROFILE
+
+_Thread_local ProfileCounters profile_counters;
+
+// Contadores já entregues pelas threads que terminaram trabalho paralelo
+static ProfileCounters merged_counters;
+static pthread_mutex_t merged_lock = PTHREAD_MUTEX_INITIALIZER;
+
+// Soma os contadores de 'source' a 'target' (os tempos por fase não)
+static void add_counters(ProfileCounters* target, const ProfileCounters* source) {
+    target->decisions += source->decisions;
+    target->candidates += source->candidates;
+    target->idle_skips += source->idle_skips;
+    target->idle_time += source->idle_time;
+    target->context_switches += source->context_switches;
+    target->heap_operations += source->heap_operations;
+    target->allocations += source->allocations;
+}
+
+double profile_clock(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+bool profile_enabled(void) {
+    return true;
+}
+
+void profile_reset(void) {
+    pthread_mutex_lock(&merged_lock);
+    memset(&merged_counters, 0, sizeof(merged_counters));
+    pthread_mutex_unlock(&merged_lock);
+    memset(&profile_counters, 0, sizeof(profile_counters));
+}
+
+ProfileCounters profile_snapshot(void) {
+    ProfileCounters snapshot = profile_counters;
+    pthread_mutex_lock(&merged_lock);
+    add_counters(&snapshot, &merged_counters);
+    pthread_mutex_unlock(&merged_lock);
+    return snapshot;
+}
+
+void profile_flush_thread(void) {
+    pthread_mutex_lock(&merged_lock);
+    add_counters(&merged_counters, &profile_counters);
+    pthread_mutex_unlock(&merged_lock);
+
+    // Os tempos por fase ficam na thread que os mediu
+    double phase_seconds[PROFILE_PHASE_COUNT];
+    memcpy(phase_seconds, profile_counters.phase_seconds, sizeof(phase_seconds));
+    memset(&profile_counters, 0, sizeof(profile_counters));
+    memcpy(profile_counters.phase_seconds, phase_seconds, sizeof(phase_seconds));
+}
+
+#else
+
+bool profile_enabled(void) {
+    return false;
+}
+
+void profile_reset(void) {
+}
+
+ProfileCounters profile_snapshot(void) {
+    ProfileCounters empty;
+    memset(&empty, 0, sizeof(empty));
+    return empty;
+}
+
+void profile_flush_thread(void) {
+}
+
+#endif
+
+void profile_print_json(FILE* output, const char* algorithm, int process_count,
+                        SimulationStats stats, const ProfileCounters* counters) {
+    fprintf(output, "{\n");
+    fprintf(output, "  \"algorithm\": \"%s\",\n", algorithm);
+    fprintf(output, "  \"processes\": %d,\n", process_count);
+    fprintf(output, "  \"stats\": {\n");
+    fprintf(output, "    \"avg_waiting_time\": %.6f,\n", stats.avg_waiting_time);
+    fprintf(output, "    \"avg_turnaround_time\": %.6f,\n", stats.avg_turnaround_time);
+    fprintf(output, "    \"avg_response_time\": %.6f,\n", stats.avg_response_time);
+    fprintf(output, "    \"cpu_utilization\": %.6f,\n", stats.cpu_utilization);
+    fprintf(output, "    \"throughput\": %.6f,\n", stats.throughput);
+    fprintf(output, "    \"deadline_misses\": %lld\n", stats.deadline_misses);
+    fprintf(output, "  },\n");
+
+    if (!profile_enabled()) {
+        // Sem -DPROFILE não há contadores a mostrar
+        fprintf(output, "  \"profile\": null\n}\n");
+        return;
+    }
+
+    unsigned long long decisions = counters->decisions;
+    fprintf(output, "  \"profile\": {\n");
+    fprintf(output, "    \"decisions\": %llu,\n", decisions);
+    fprintf(output, "    \"candidates\": %llu,\n", counters->candidates);
+    fprintf(output, "    \"candidates_per_decision\": %.3f,\n",
+            decisions > 0 ? (double)counters->candidates / decisions : 0.0);
+    fprintf(output, "    \"idle_skips\": %llu,\n", counters->idle_skips);
+    fprintf(output, "    \"idle_time\": %llu,\n", counters->idle_time);
+    fprintf(output, "    \"context_switches\": %llu,\n", counters->context_switches);
+    fprintf(output, "    \"heap_operations\": %llu,\n", counters->heap_operations);
+    fprintf(output, "    \"allocations\": %llu,\n", counters->allocations);
+    fprintf(output, "    \"phase_seconds\": {");
+    for (int p = 0; p < PROFILE_PHASE_COUNT; p++) {
+        fprintf(output, "%s\"%s\": %.9f", p > 0 ? ", " : " ", phase_names[p], counters->phase_seconds[p]);
+    }
+    fprintf(output, " }\n");
+    fprintf(output, "  }\n}\n");
+}
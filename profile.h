@@ -0,0 +1,75 @@
+// ----------------------------------------------------------------
+//        Contadores de instrumentação e tempos por fase
+
+//   Só existem quando o programa é compilado com -DPROFILE
+//   (make PROFILE=1); caso contrário as macros não geram código.
+//   Cada thread conta nos seus próprios contadores (sem partilha no
+//   caminho quente) e as threads de parallel_for, parallel_team e do
+//   pool juntam-nos aos do processo quando terminam o trabalho, antes
+//   de a thread que as lançou continuar. Os tempos por fase são tempo
+//   real medido pela thread que abre a fase (incluindo a espera pelas
+//   threads que lança) e não são somados entre threads.
+// ----------------------------------------------------------------
+
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include <stdio.h>
+#include <stdbool.h>
+#include "stats.h"
+
+typedef enum {
+    PROFILE_GENERATE,
+    PROFILE_SORT,
+    PROFILE_SIMULATE,
+    PROFILE_STATS,
+    PROFILE_OUTPUT,
+    PROFILE_PHASE_COUNT
+} ProfilePhase;
+
+typedef struct {
+    unsigned long long decisions;          // Fatias de CPU atribuídas
+    unsigned long long candidates;         // Candidatos examinados nas seleções
+    unsigned long long idle_skips;         // Avanços do relógio sem processo pronto
+    unsigned long long idle_time;          // Tempo total desses avanços
+    unsigned long long context_switches;   // Mudanças do processo em execução
+    unsigned long long heap_operations;    // Inserções, remoções e substituições
+    unsigned long long allocations;        // Pedidos de memória dos módulos instrumentados
+    double phase_seconds[PROFILE_PHASE_COUNT];
+} ProfileCounters;
+
+#ifdef PROFILE
+
+extern _Thread_local ProfileCounters profile_counters;
+double profile_clock(void);
+
+#define PROFILE_COUNT(field, amount) \
+    (profile_counters.field += (unsigned long long)(amount))
+#define PROFILE_PHASE_BEGIN() double profile_phase_start = profile_clock()
+#define PROFILE_PHASE_END(phase) \
+    (profile_counters.phase_seconds[phase] += profile_clock() - profile_phase_start)
+
+#else
+
+#define PROFILE_COUNT(field, amount) ((void)0)
+#define PROFILE_PHASE_BEGIN() ((void)0)
+#define PROFILE_PHASE_END(phase) ((void)0)
+
+#endif
+
+// Se os contadores foram compilados
+bool profile_enabled(void);
+
+void profile_reset(void);
+
+// Contadores do processo: os já juntados mais os da thread que consulta
+ProfileCounters profile_snapshot(void);
+
+// Junta os contadores da thread atual aos do processo e limpa-os
+void profile_flush_thread(void);
+
+// Objeto JSON com as estatísticas da simulação e os contadores
+void profile_print_json(FILE* output, const char* algorithm, int process_count,
+                        SimulationStats stats, const ProfileCounters* counters);
+
+#endif
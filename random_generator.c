@@ -150,4 +150,95 @@ int generate_priority(bool weighted) {
     } else {
         return uniform_random_int(1, 10);
     }
-}
\ No newline at end of file
+}
+
+
+// ----------------------------------------------------------------
+//                 Streams independentes (xoshiro256**)
+// ----------------------------------------------------------------
+
+static unsigned long long splitmix64(unsigned long long* state) {
+    unsigned long long z = (*state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+static inline unsigned long long rotl(unsigned long long x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+static unsigned long long stream_next(RandomStream* stream) {
+    unsigned long long* s = stream->s;
+    unsigned long long result = rotl(s[1] * 5, 7) * 9;
+    unsigned long long t = s[1] << 17;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rotl(s[3], 45);
+    return result;
+}
+
+// O estado é derivado da seed e do identificador do stream com splitmix64,
+// pelo que streams diferentes ficam descorrelacionados
+void stream_init(RandomStream* stream, unsigned long long seed, unsigned long long stream_id) {
+    unsigned long long state = seed;
+    unsigned long long mixed = splitmix64(&state) ^ (stream_id * 0xD1B54A32D192ED03ULL);
+    for (int i = 0; i < 4; i++) {
+        stream->s[i] = splitmix64(&mixed);
+    }
+}
+
+double stream_uniform(RandomStream* stream) {
+    return (stream_next(stream) >> 11) * (1.0 / 9007199254740992.0);  // 53 bits
+}
+
+double stream_exponential(RandomStream* stream, double lambda) {
+    return -log(1.0 - stream_uniform(stream)) / lambda;
+}
+
+double stream_normal(RandomStream* stream, double mean, double stddev) {
+    double u1, u2;
+    do {
+        u1 = stream_uniform(stream);
+        u2 = stream_uniform(stream);
+    } while (u1 <= 0.0);  // Evita log(0)
+    return mean + stddev * sqrt(-2.0 * log(u1)) * cos(2.0 * M_PI * u2);
+}
+
+int stream_uniform_int(RandomStream* stream, int min, int max) {
+    unsigned long long range = (unsigned long long)((long long)max - min + 1);
+    return (int)(min + (long long)(stream_next(stream) % range));
+}
+
+int stream_poisson(RandomStream* stream, double lambda) {
+    double L = exp(-lambda);
+    double p = 1.0;
+    int k = 0;
+    
+    do {
+        k++;
+        p *= stream_uniform(stream);
+    } while (p > L);
+    
+    return k - 1;
+}
+
+int stream_weighted(RandomStream* stream, const int weights[], int n) {
+    int sum = 0;
+    for (int i = 0; i < n; i++) {
+        sum += weights[i];
+    }
+    
+    int r = stream_uniform_int(stream, 0, sum - 1);
+    for (int i = 0; i < n; i++) {
+        if (r < weights[i]) {
+            return i;
+        }
+        r -= weights[i];
+    }
+    
+    return n - 1;
+}
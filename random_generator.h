@@ -24,4 +24,21 @@ int generate_arrival_interval(int dist_type, double param1, double param2);
 // Função para gerar prioridades conforme especificado no projeto
 int generate_priority(bool weighted);  // Se weighted=true, usa prioridades mais baixas com maior probabilidade
 
+// ----------------------------------------------------------------
+//  Streams independentes (xoshiro256**), sem estado global.
+//  Cada par (seed, stream_id) produz uma sequência própria, o que
+//  permite gerar blocos em paralelo de forma determinística.
+// ----------------------------------------------------------------
+typedef struct {
+    unsigned long long s[4];
+} RandomStream;
+
+void stream_init(RandomStream* stream, unsigned long long seed, unsigned long long stream_id);
+double stream_uniform(RandomStream* stream);                       // Uniforme em [0, 1)
+double stream_exponential(RandomStream* stream, double lambda);
+double stream_normal(RandomStream* stream, double mean, double stddev);
+int stream_uniform_int(RandomStream* stream, int min, int max);
+int stream_poisson(RandomStream* stream, double lambda);
+int stream_weighted(RandomStream* stream, const int weights[], int n);
+
 #endif
\ No newline at end of file
@@ -0,0 +1,239 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "replication.h"
+#include "stats.h"
+#include "parallel.h"
+
+// Replicações executadas entre testes de paragem. É fixo (não depende do
+// número de threads) para que o ponto de paragem seja determinístico.
+#define REPLICATION_BATCH 16
+
+#define METRIC_COUNT 6
+
+typedef struct {
+    const ReplicationConfig* config;
+    int first;                  // Índice da primeira replicação do lote
+    SimulationStats* results;   // Um resultado por replicação do lote
+} ReplicationBatch;
+
+// Acumulador de Welford (média e variância numa passagem)
+typedef struct {
+    int n;
+    double mean;
+    double m2;
+} Accumulator;
+
+ReplicationConfig default_replication_config(void) {
+    ReplicationConfig config;
+    config.type = FCFS;
+    config.process_count = 1000;
+    config.max_time = 1000000;
+    config.quantum = 4;
+    config.arrival_dist = DIST_EXPONENTIAL;
+    config.burst_dist = DIST_NORMAL;
+    config.seed = 1;
+    config.min_replications = 10;
+    config.max_replications = 1000;
+    config.target_precision = 0.05;
+    config.absolute_precision = 0.01;
+    config.confidence = 0.95;
+    return config;
+}
+
+static void run_one_replication(int task, void* ctx) {
+    ReplicationBatch* batch = (ReplicationBatch*)ctx;
+    const ReplicationConfig* config = batch->config;
+    int replication = batch->first + task;
+
+    Process** processes = (Process**)malloc(config->process_count * sizeof(Process*));
+    if (processes == NULL) {
+        perror("Erro ao alocar memória para replicação");
+        exit(EXIT_FAILURE);
+    }
+
+    // Corre dentro de parallel_for: a geração e a ordenação ficam nesta
+    // thread (parallel_thread_count() devolve 1 aqui)
+    int count = generate_processes_parallel(processes, config->process_count,
+                                            config->arrival_dist, config->burst_dist,
+                                            config->max_time, config->seed + replication);
+    schedule(processes, count, config->type, config->quantum, config->max_time);
+    batch->results[task] = calculate_stats(processes, count, config->max_time);
+
+    for (int i = 0; i < count; i++) {
+        free_process(processes[i]);
+    }
+    free(processes);
+}
+
+static void accumulate(Accumulator* acc, double value) {
+    acc->n++;
+    double delta = value - acc->mean;
+    acc->mean += delta / acc->n;
+    acc->m2 += delta * (value - acc->mean);
+}
+
+static MetricEstimate estimate(const Accumulator* acc, double confidence) {
+    MetricEstimate e;
+    e.mean = acc->mean;
+    e.stddev = acc->n > 1 ? sqrt(acc->m2 / (acc->n - 1)) : 0.0;
+    e.half_width = acc->n > 1
+        ? student_t_quantile(confidence, acc->n - 1) * e.stddev / sqrt((double)acc->n)
+        : INFINITY;
+    return e;
+}
+
+bool estimate_precise_enough(MetricEstimate e, double target, double absolute) {
+    if (e.half_width == 0.0) return true;            // Métrica constante
+    return e.half_width <= target * fabs(e.mean) || e.half_width <= absolute;
+}
+
+// Função beta incompleta regularizada I_x(a, b), por fração contínua
+// (algoritmo de Lentz, convergência rápida para x < (a + 1) / (a + b + 2))
+static double beta_continued_fraction(double a, double b, double x) {
+    const double tiny = 1e-300;
+    double c = 1.0;
+    double d = 1.0 - (a + b) * x / (a + 1.0);
+    if (fabs(d) < tiny) d = tiny;
+    d = 1.0 / d;
+    double h = d;
+    for (int m = 1; m <= 300; m++) {
+        double m2 = 2.0 * m;
+        double num = m * (b - m) * x / ((a + m2 - 1.0) * (a + m2));
+        d = 1.0 + num * d;
+        if (fabs(d) < tiny) d = tiny;
+        c = 1.0 + num / c;
+        if (fabs(c) < tiny) c = tiny;
+        d = 1.0 / d;
+        h *= d * c;
+        num = -(a + m) * (a + b + m) * x / ((a + m2) * (a + m2 + 1.0));
+        d = 1.0 + num * d;
+        if (fabs(d) < tiny) d = tiny;
+        c = 1.0 + num / c;
+        if (fabs(c) < tiny) c = tiny;
+        d = 1.0 / d;
+        double delta = d * c;
+        h *= delta;
+        if (fabs(delta - 1.0) < 1e-15) break;
+    }
+    return h;
+}
+
+static double incomplete_beta(double a, double b, double x) {
+    if (x <= 0.0) return 0.0;
+    if (x >= 1.0) return 1.0;
+    double front = exp(lgamma(a + b) - lgamma(a) - lgamma(b) +
+                       a * log(x) + b * log(1.0 - x));
+    if (x < (a + 1.0) / (a + b + 2.0)) {
+        return front * beta_continued_fraction(a, b, x) / a;
+    }
+    return 1.0 - front * beta_continued_fraction(b, a, 1.0 - x) / b;
+}
+
+// P(|T| <= t) para a distribuição t de Student com v graus de liberdade
+static double student_t_central(double t, double v) {
+    return 1.0 - incomplete_beta(v / 2.0, 0.5, v / (v + t * t));
+}
+
+// Inversão exata da função de distribuição por bisseção (os intervalos
+// com poucas replicações dependem de a cauda para df 1-3 estar certa)
+double student_t_quantile(double confidence, int degrees_of_freedom) {
+    double v = degrees_of_freedom;
+    double low = 0.0;
+    double high = 1.0;
+    while (student_t_central(high, v) < confidence && high < 1e12) {
+        low = high;
+        high *= 2.0;
+    }
+    for (int i = 0; i < 200 && high - low > 1e-12 * high; i++) {
+        double mid = (low + high) / 2.0;
+        if (student_t_central(mid, v) < confidence) {
+            low = mid;
+        } else {
+            high = mid;
+        }
+    }
+    return (low + high) / 2.0;
+}
+
+ReplicationResult run_replications(const ReplicationConfig* config) {
+    Accumulator acc[METRIC_COUNT] = {{0}};
+    ReplicationResult result = {0};
+    int capacity = config->min_replications > REPLICATION_BATCH
+                   ? config->min_replications : REPLICATION_BATCH;
+    SimulationStats* results = (SimulationStats*)malloc(capacity * sizeof(SimulationStats));
+    if (results == NULL) {
+        perror("Erro ao alocar memória para replicações");
+        exit(EXIT_FAILURE);
+    }
+
+    bool was_verbose = scheduler_is_verbose();
+    set_scheduler_verbose(false);
+
+    int done = 0;
+    while (done < config->max_replications) {
+        int batch_size = done == 0 ? config->min_replications : REPLICATION_BATCH;
+        if (batch_size < 2) batch_size = 2;
+        if (batch_size > capacity) batch_size = capacity;
+        if (done + batch_size > config->max_replications) {
+            batch_size = config->max_replications - done;
+        }
+
+        ReplicationBatch batch = { config, done, results };
+        parallel_for(batch_size, parallel_thread_count(), run_one_replication, &batch);
+
+        // Acumula por ordem de replicação (resultado independente do escalonamento das threads)
+        for (int r = 0; r < batch_size; r++) {
+            accumulate(&acc[0], results[r].avg_waiting_time);
+            accumulate(&acc[1], results[r].avg_turnaround_time);
+            accumulate(&acc[2], results[r].cpu_utilization);
+            accumulate(&acc[3], results[r].throughput);
+            accumulate(&acc[4], results[r].deadline_misses);
+            accumulate(&acc[5], results[r].avg_response_time);
+        }
+        done += batch_size;
+
+        result.avg_waiting_time = estimate(&acc[0], config->confidence);
+        result.avg_turnaround_time = estimate(&acc[1], config->confidence);
+        result.cpu_utilization = estimate(&acc[2], config->confidence);
+        result.throughput = estimate(&acc[3], config->confidence);
+        result.deadline_misses = estimate(&acc[4], config->confidence);
+        result.avg_response_time = estimate(&acc[5], config->confidence);
+
+        MetricEstimate all[METRIC_COUNT] = {
+            result.avg_waiting_time, result.avg_turnaround_time, result.cpu_utilization,
+            result.throughput, result.deadline_misses, result.avg_response_time
+        };
+        result.converged = true;
+        for (int m = 0; m < METRIC_COUNT; m++) {
+            if (!estimate_precise_enough(all[m], config->target_precision, config->absolute_precision)) {
+                result.converged = false;
+            }
+        }
+        if (result.converged) break;
+    }
+
+    set_scheduler_verbose(was_verbose);
+    result.replications = done;
+    free(results);
+    return result;
+}
+
+static void print_estimate(const char* name, MetricEstimate e) {
+    printf("%-26s %12.4f ± %-10.4f (desvio padrão %.4f)\n", name, e.mean, e.half_width, e.stddev);
+}
+
+void print_replication_result(const ReplicationConfig* config, const ReplicationResult* result) {
+    printf("\n=== Replicações Monte Carlo (%s) ===\n", scheduler_type_name(config->type));
+    printf("Replicações:              %d (%s)\n", result->replications,
+           result->converged ? "precisão atingida" : "limite de replicações atingido");
+    printf("Confiança:                %.0f%%, precisão pedida ±%.1f%% da média (ou ±%g)\n",
+           config->confidence * 100.0, config->target_precision * 100.0, config->absolute_precision);
+    print_estimate("Tempo médio de espera:", result->avg_waiting_time);
+    print_estimate("Tempo médio de retorno:", result->avg_turnaround_time);
+    print_estimate("Tempo médio de resposta:", result->avg_response_time);
+    print_estimate("Utilização da CPU (%):", result->cpu_utilization);
+    print_estimate("Throughput:", result->throughput);
+    print_estimate("Deadlines perdidas:", result->deadline_misses);
+    printf("================================\n");
+}
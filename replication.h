@@ -0,0 +1,64 @@
+// ----------------------------------------------------------------
+//        Replicações Monte Carlo com intervalos de confiança
+
+//   Executa K replicações independentes (seed diferente em cada uma)
+//   de geração + escalonamento + estatísticas e pára assim que todos
+//   os intervalos de confiança atingem a precisão pedida
+// ----------------------------------------------------------------
+
+#ifndef REPLICATION_H
+#define REPLICATION_H
+
+#include <stdbool.h>
+#include "process.h"
+#include "scheduler.h"
+
+typedef struct {
+    SchedulerType type;
+    int process_count;
+    SimTime max_time;
+    int quantum;
+    DistributionType arrival_dist;
+    DistributionType burst_dist;
+    unsigned long long seed;     // Replicação r usa seed + r
+    int min_replications;        // Replicações antes do primeiro teste de paragem
+    int max_replications;        // Limite máximo de replicações
+    double target_precision;     // Meia-largura máxima relativa à média (ex.: 0.05 = 5%)
+    double absolute_precision;   // Meia-largura sempre aceite (métricas com média perto de zero)
+    double confidence;           // Nível de confiança (ex.: 0.95)
+} ReplicationConfig;
+
+typedef struct {
+    double mean;
+    double stddev;
+    double half_width;           // Meia-largura do intervalo de confiança
+} MetricEstimate;
+
+typedef struct {
+    int replications;
+    bool converged;              // true se a precisão pedida foi atingida
+    MetricEstimate avg_waiting_time;
+    MetricEstimate avg_turnaround_time;
+    MetricEstimate cpu_utilization;
+    MetricEstimate throughput;
+    MetricEstimate deadline_misses;
+    MetricEstimate avg_response_time;
+} ReplicationResult;
+
+// Configuração por omissão (FCFS, 1000 processos, 95%, 5%)
+ReplicationConfig default_replication_config(void);
+
+// Executa as replicações em paralelo; o resultado só depende da seed
+ReplicationResult run_replications(const ReplicationConfig* config);
+
+void print_replication_result(const ReplicationConfig* config, const ReplicationResult* result);
+
+// Meia-largura dentro da precisão relativa 'target' ou da absoluta
+// 'absolute'. Uma métrica com média perto de zero (por exemplo deadlines
+// perdidas raras) nunca atinge uma precisão relativa, daí a absoluta.
+bool estimate_precise_enough(MetricEstimate e, double target, double absolute);
+
+// Quantil da distribuição t de Student (bilateral) para o nível de confiança dado
+double student_t_quantile(double confidence, int degrees_of_freedom);
+
+#endif
@@ -0,0 +1,452 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "result_cache.h"
+
+#define CACHE_MAGIC "PSRC"
+#define CACHE_FORMAT_VERSION 3
+#define CACHE_BUCKETS 256
+
+typedef struct {
+    unsigned long long fingerprint;
+    int count;
+    int type;
+    int quantum;
+    int aging_interval;
+    SimTime max_time;
+} CacheKey;
+
+// Resultado de um processo, pela ordem em que schedule() deixa o vetor
+typedef struct {
+    SimTime completion_time;
+    SimTime first_run_time;
+    SimTime remaining_time;
+    int input_index;          // Posição do processo no vetor de entrada
+    int deadline_miss_count;
+    int missed_deadline;
+} CachedProcess;
+
+typedef struct CacheEntry {
+    CacheKey key;
+    unsigned long long key_hash;
+    SimulationStats stats;
+    CachedProcess* results;
+    struct CacheEntry* lru_prev;     // Mais recente
+    struct CacheEntry* lru_next;     // Menos recente
+    struct CacheEntry* chain_next;   // Colisões na tabela de dispersão
+} CacheEntry;
+
+struct ResultCache {
+    CacheEntry* buckets[CACHE_BUCKETS];
+    CacheEntry* lru_head;
+    CacheEntry* lru_tail;
+    int entries;
+    int max_entries;
+    size_t bytes;
+    size_t max_bytes;
+    char* disk_dir;
+    pthread_mutex_t lock;
+};
+
+// ---------------- Dispersão ----------------
+
+static inline unsigned long long mix64(unsigned long long h, unsigned long long v) {
+    h ^= v * 0x9E3779B97F4A7C15ULL;
+    h = (h << 31) | (h >> 33);
+    return h * 0xBF58476D1CE4E5B9ULL;
+}
+
+unsigned long long workload_fingerprint(Process** processes, int count) {
+    unsigned long long h = mix64(0x243F6A8885A308D3ULL, (unsigned long long)count);
+    for (int i = 0; i < count; i++) {
+        const Process* p = processes[i];
+        // Os tempos entram com os 64 bits
+        h = mix64(h, ((unsigned long long)(unsigned int)p->pid << 32) | (unsigned int)p->priority);
+        h = mix64(h, (unsigned long long)p->arrival_time);
+        h = mix64(h, (unsigned long long)p->burst_time);
+        h = mix64(h, (unsigned long long)p->period);
+        h = mix64(h, (unsigned long long)p->deadline);
+    }
+    return h ^ (h >> 29);
+}
+
+static unsigned long long key_hash(const CacheKey* key) {
+    unsigned long long h = mix64(key->fingerprint, (unsigned long long)key->count);
+    h = mix64(h, ((unsigned long long)(unsigned int)key->type << 32) | (unsigned int)key->quantum);
+    h = mix64(h, (unsigned long long)key->max_time);
+    h = mix64(h, (unsigned long long)(unsigned int)key->aging_interval);
+    return h ^ (h >> 29);
+}
+
+static bool key_equal(const CacheKey* a, const CacheKey* b) {
+    return a->fingerprint == b->fingerprint && a->count == b->count && a->type == b->type &&
+           a->quantum == b->quantum && a->max_time == b->max_time &&
+           a->aging_interval == b->aging_interval;
+}
+
+static size_t entry_bytes(const CacheEntry* entry) {
+    return sizeof(CacheEntry) + (size_t)entry->key.count * sizeof(CachedProcess);
+}
+
+// ---------------- Camada em memória (LRU) ----------------
+
+ResultCache* result_cache_create(int max_entries, size_t max_bytes, const char* disk_dir) {
+    ResultCache* cache = (ResultCache*)calloc(1, sizeof(ResultCache));
+    if (cache == NULL) {
+        perror("Erro ao alocar memória para a cache");
+        exit(EXIT_FAILURE);
+    }
+    cache->max_entries = max_entries > 0 ? max_entries : 1;
+    cache->max_bytes = max_bytes;
+    pthread_mutex_init(&cache->lock, NULL);
+
+    if (disk_dir != NULL) {
+        if (mkdir(disk_dir, 0755) != 0 && errno != EEXIST) {
+            perror("Erro ao criar a diretoria da cache");
+        } else {
+            cache->disk_dir = strdup(disk_dir);
+        }
+    }
+    return cache;
+}
+
+static void free_entry(CacheEntry* entry) {
+    free(entry->results);
+    free(entry);
+}
+
+void result_cache_destroy(ResultCache* cache) {
+    if (cache == NULL) return;
+    CacheEntry* entry = cache->lru_head;
+    while (entry != NULL) {
+        CacheEntry* next = entry->lru_next;
+        free_entry(entry);
+        entry = next;
+    }
+    pthread_mutex_destroy(&cache->lock);
+    free(cache->disk_dir);
+    free(cache);
+}
+
+static void lru_unlink(ResultCache* cache, CacheEntry* entry) {
+    if (entry->lru_prev) entry->lru_prev->lru_next = entry->lru_next;
+    else cache->lru_head = entry->lru_next;
+    if (entry->lru_next) entry->lru_next->lru_prev = entry->lru_prev;
+    else cache->lru_tail = entry->lru_prev;
+    entry->lru_prev = entry->lru_next = NULL;
+}
+
+static void lru_push_front(ResultCache* cache, CacheEntry* entry) {
+    entry->lru_prev = NULL;
+    entry->lru_next = cache->lru_head;
+    if (cache->lru_head) cache->lru_head->lru_prev = entry;
+    cache->lru_head = entry;
+    if (cache->lru_tail == NULL) cache->lru_tail = entry;
+}
+
+static CacheEntry* memory_lookup(ResultCache* cache, const CacheKey* key, unsigned long long hash) {
+    for (CacheEntry* e = cache->buckets[hash % CACHE_BUCKETS]; e != NULL; e = e->chain_next) {
+        if (e->key_hash == hash && key_equal(&e->key, key)) {
+            lru_unlink(cache, e);
+            lru_push_front(cache, e);
+            return e;
+        }
+    }
+    return NULL;
+}
+
+static void memory_remove(ResultCache* cache, CacheEntry* entry) {
+    CacheEntry** link = &cache->buckets[entry->key_hash % CACHE_BUCKETS];
+    while (*link != entry) {
+        link = &(*link)->chain_next;
+    }
+    *link = entry->chain_next;
+    lru_unlink(cache, entry);
+    cache->entries--;
+    cache->bytes -= entry_bytes(entry);
+    free_entry(entry);
+}
+
+// Insere (a cache fica dona da entrada) e remove as menos usadas se exceder os limites
+static void memory_insert(ResultCache* cache, CacheEntry* entry) {
+    size_t bucket = entry->key_hash % CACHE_BUCKETS;
+    entry->chain_next = cache->buckets[bucket];
+    cache->buckets[bucket] = entry;
+    lru_push_front(cache, entry);
+    cache->entries++;
+    cache->bytes += entry_bytes(entry);
+
+    while (cache->lru_tail != entry &&
+           (cache->entries > cache->max_entries ||
+            (cache->max_bytes > 0 && cache->bytes > cache->max_bytes))) {
+        memory_remove(cache, cache->lru_tail);
+    }
+}
+
+// ---------------- Camada em disco ----------------
+
+static void disk_path(const ResultCache* cache, unsigned long long hash, char* path, size_t size) {
+    snprintf(path, size, "%s/%016llx.psc", cache->disk_dir, hash);
+}
+
+// Os campos são gravados um a um com largura fixa (int32, int64, double na
+// ordem de bytes da máquina), sem o enchimento das estruturas em memória
+static bool put_i32(FILE* file, int value) {
+    int32_t v = value;
+    return fwrite(&v, sizeof(v), 1, file) == 1;
+}
+
+static bool put_i64(FILE* file, long long value) {
+    int64_t v = value;
+    return fwrite(&v, sizeof(v), 1, file) == 1;
+}
+
+static bool put_f64(FILE* file, double value) {
+    return fwrite(&value, sizeof(value), 1, file) == 1;
+}
+
+static bool get_i32(FILE* file, int* value) {
+    int32_t v;
+    if (fread(&v, sizeof(v), 1, file) != 1) return false;
+    *value = v;
+    return true;
+}
+
+static bool get_i64(FILE* file, long long* value) {
+    int64_t v;
+    if (fread(&v, sizeof(v), 1, file) != 1) return false;
+    *value = v;
+    return true;
+}
+
+static bool get_f64(FILE* file, double* value) {
+    return fread(value, sizeof(*value), 1, file) == 1;
+}
+
+static bool write_key(FILE* file, const CacheKey* key) {
+    return put_i64(file, (long long)key->fingerprint) && put_i32(file, key->count) &&
+           put_i32(file, key->type) && put_i32(file, key->quantum) &&
+           put_i32(file, key->aging_interval) && put_i64(file, key->max_time);
+}
+
+static bool read_key(FILE* file, CacheKey* key) {
+    long long fingerprint;
+    memset(key, 0, sizeof(*key));
+    bool ok = get_i64(file, &fingerprint) && get_i32(file, &key->count) &&
+              get_i32(file, &key->type) && get_i32(file, &key->quantum) &&
+              get_i32(file, &key->aging_interval) && get_i64(file, &key->max_time);
+    key->fingerprint = (unsigned long long)fingerprint;
+    return ok;
+}
+
+static bool write_stats(FILE* file, const SimulationStats* stats) {
+    return put_f64(file, stats->avg_waiting_time) && put_f64(file, stats->avg_turnaround_time) &&
+           put_f64(file, stats->cpu_utilization) && put_f64(file, stats->throughput) &&
+           put_i64(file, stats->deadline_misses) && put_f64(file, stats->avg_response_time);
+}
+
+static bool read_stats(FILE* file, SimulationStats* stats) {
+    return get_f64(file, &stats->avg_waiting_time) && get_f64(file, &stats->avg_turnaround_time) &&
+           get_f64(file, &stats->cpu_utilization) && get_f64(file, &stats->throughput) &&
+           get_i64(file, &stats->deadline_misses) && get_f64(file, &stats->avg_response_time);
+}
+
+static bool write_result(FILE* file, const CachedProcess* r) {
+    return put_i64(file, r->completion_time) && put_i64(file, r->first_run_time) &&
+           put_i64(file, r->remaining_time) && put_i32(file, r->input_index) &&
+           put_i32(file, r->deadline_miss_count) && put_i32(file, r->missed_deadline);
+}
+
+static bool read_result(FILE* file, CachedProcess* r, int count) {
+    return get_i64(file, &r->completion_time) && get_i64(file, &r->first_run_time) &&
+           get_i64(file, &r->remaining_time) && get_i32(file, &r->input_index) &&
+           r->input_index >= 0 && r->input_index < count &&
+           get_i32(file, &r->deadline_miss_count) && get_i32(file, &r->missed_deadline);
+}
+
+static CacheEntry* disk_load(const ResultCache* cache, const CacheKey* key, unsigned long long hash) {
+    char path[4096];
+    disk_path(cache, hash, path, sizeof(path));
+    FILE* file = fopen(path, "rb");
+    if (file == NULL) return NULL;
+
+    char magic[4];
+    int version;
+    CacheKey stored;
+    CacheEntry* entry = (CacheEntry*)calloc(1, sizeof(CacheEntry));
+    CachedProcess* results = (CachedProcess*)malloc((key->count > 0 ? (size_t)key->count : 1) *
+                                                    sizeof(CachedProcess));
+    bool ok = entry != NULL && results != NULL &&
+              fread(magic, 1, 4, file) == 4 && memcmp(magic, CACHE_MAGIC, 4) == 0 &&
+              get_i32(file, &version) && version == CACHE_FORMAT_VERSION &&
+              read_key(file, &stored) && key_equal(&stored, key) &&
+              read_stats(file, &entry->stats);
+    for (int k = 0; ok && k < key->count; k++) {
+        ok = read_result(file, &results[k], key->count);
+    }
+    fclose(file);
+
+    if (!ok) {
+        free(entry);
+        free(results);
+        return NULL;
+    }
+    entry->key = *key;
+    entry->key_hash = hash;
+    entry->results = results;
+    return entry;
+}
+
+// Sufixo dos ficheiros temporários, único dentro do processo
+static atomic_uint temp_serial;
+
+static void disk_store(const ResultCache* cache, const CacheEntry* entry) {
+    char path[4096], temp[4200];
+    disk_path(cache, entry->key_hash, path, sizeof(path));
+    // Cada escrita tem o seu temporário (pid + contador): duas threads ou
+    // dois processos a gravar a mesma chave não se truncam um ao outro
+    snprintf(temp, sizeof(temp), "%s.%ld.%u.tmp", path, (long)getpid(),
+             atomic_fetch_add(&temp_serial, 1));
+
+    FILE* file = fopen(temp, "wb");
+    if (file == NULL) return;
+    bool ok = fwrite(CACHE_MAGIC, 1, 4, file) == 4 &&
+              put_i32(file, CACHE_FORMAT_VERSION) &&
+              write_key(file, &entry->key) &&
+              write_stats(file, &entry->stats);
+    for (int k = 0; ok && k < entry->key.count; k++) {
+        ok = write_result(file, &entry->results[k]);
+    }
+    ok = fclose(file) == 0 && ok;
+
+    // Escreve num ficheiro temporário e renomeia para nunca deixar entradas parciais
+    if (ok) {
+        rename(temp, path);
+    } else {
+        remove(temp);
+    }
+}
+
+// ---------------- Escalonamento com cache ----------------
+
+typedef struct {
+    const Process* process;
+    int index;
+} PointerIndex;
+
+static int compare_pointer(const void* a, const void* b) {
+    const Process* x = ((const PointerIndex*)a)->process;
+    const Process* y = ((const PointerIndex*)b)->process;
+    return (x > y) - (x < y);
+}
+
+// Repõe a ordem e os resultados guardados no vetor de entrada
+static void apply_entry(const CacheEntry* entry, Process** processes, int count) {
+    Process** input = (Process**)malloc(count * sizeof(Process*));
+    if (input == NULL) {
+        perror("Erro ao alocar memória para a cache");
+        exit(EXIT_FAILURE);
+    }
+    memcpy(input, processes, count * sizeof(Process*));
+
+    for (int k = 0; k < count; k++) {
+        const CachedProcess* r = &entry->results[k];
+        Process* p = input[r->input_index];
+        p->completion_time = r->completion_time;
+        p->first_run_time = r->first_run_time;
+        p->remaining_time = r->remaining_time;
+        p->deadline_miss_count = r->deadline_miss_count;
+        p->missed_deadline = r->missed_deadline != 0;
+        processes[k] = p;
+    }
+    free(input);
+}
+
+SimulationStats schedule_cached(ResultCache* cache, Process** processes, int count,
+                                SchedulerType type, int quantum, SimTime max_time, bool* hit) {
+    CacheKey key;
+    memset(&key, 0, sizeof(key));
+    key.fingerprint = workload_fingerprint(processes, count);
+    key.count = count;
+    key.type = type;
+    key.quantum = quantum;
+    key.max_time = max_time;
+    key.aging_interval = (type == PRIORITY_NP || type == PRIORITY_P) ? get_priority_aging() : 0;
+    unsigned long long hash = key_hash(&key);
+
+    pthread_mutex_lock(&cache->lock);
+    CacheEntry* entry = memory_lookup(cache, &key, hash);
+    if (entry == NULL && cache->disk_dir != NULL) {
+        entry = disk_load(cache, &key, hash);
+        if (entry != NULL) memory_insert(cache, entry);
+    }
+    if (entry != NULL) {
+        SimulationStats stats = entry->stats;
+        apply_entry(entry, processes, count);
+        pthread_mutex_unlock(&cache->lock);
+        if (hit) *hit = true;
+        if (scheduler_is_verbose()) print_schedule(processes, count);
+        return stats;
+    }
+    pthread_mutex_unlock(&cache->lock);
+    if (hit) *hit = false;
+
+    // Falha: simula e regista a permutação aplicada pelo escalonador
+    PointerIndex* positions = (PointerIndex*)malloc(count * sizeof(PointerIndex));
+    entry = (CacheEntry*)calloc(1, sizeof(CacheEntry));
+    if (positions == NULL || entry == NULL) {
+        perror("Erro ao alocar memória para a cache");
+        exit(EXIT_FAILURE);
+    }
+    for (int i = 0; i < count; i++) {
+        positions[i].process = processes[i];
+        positions[i].index = i;
+    }
+    qsort(positions, count, sizeof(PointerIndex), compare_pointer);
+
+    schedule(processes, count, type, quantum, max_time);
+    SimulationStats stats = calculate_stats(processes, count, max_time);
+
+    entry->key = key;
+    entry->key_hash = hash;
+    entry->stats = stats;
+    entry->results = (CachedProcess*)malloc((size_t)count * sizeof(CachedProcess));
+    if (entry->results == NULL) {
+        perror("Erro ao alocar memória para a cache");
+        exit(EXIT_FAILURE);
+    }
+    for (int k = 0; k < count; k++) {
+        PointerIndex probe = { processes[k], 0 };
+        PointerIndex* found = (PointerIndex*)bsearch(&probe, positions, count,
+                                                     sizeof(PointerIndex), compare_pointer);
+        CachedProcess* r = &entry->results[k];
+        memset(r, 0, sizeof(*r));
+        r->input_index = found->index;
+        r->completion_time = processes[k]->completion_time;
+        r->first_run_time = processes[k]->first_run_time;
+        r->remaining_time = processes[k]->remaining_time;
+        r->deadline_miss_count = processes[k]->deadline_miss_count;
+        r->missed_deadline = processes[k]->missed_deadline;
+    }
+    free(positions);
+
+    if (cache->disk_dir != NULL) disk_store(cache, entry);
+
+    pthread_mutex_lock(&cache->lock);
+    if (memory_lookup(cache, &key, hash) == NULL) {
+        memory_insert(cache, entry);
+    } else {
+        free_entry(entry);   // Outra thread já guardou o mesmo resultado
+    }
+    pthread_mutex_unlock(&cache->lock);
+
+    return stats;
+}
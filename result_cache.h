@@ -0,0 +1,34 @@
+// ----------------------------------------------------------------
+//          Cache de resultados de escalonamento (memoização)
+
+//   A chave é a impressão digital da carga de trabalho (conteúdo e
+//   ordem dos processos) mais o algoritmo, quantum, tempo máximo e
+//   envelhecimento. Há uma camada em memória (LRU) e, opcionalmente,
+//   uma diretoria em disco que sobrevive entre execuções.
+// ----------------------------------------------------------------
+
+#ifndef RESULT_CACHE_H
+#define RESULT_CACHE_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include "process.h"
+#include "scheduler.h"
+#include "stats.h"
+
+typedef struct ResultCache ResultCache;
+
+// max_entries/max_bytes limitam a camada em memória; disk_dir pode ser NULL
+ResultCache* result_cache_create(int max_entries, size_t max_bytes, const char* disk_dir);
+void result_cache_destroy(ResultCache* cache);
+
+// Impressão digital (hash de 64 bits) dos campos de entrada dos processos
+unsigned long long workload_fingerprint(Process** processes, int count);
+
+// Equivalente a schedule() + calculate_stats(processes, count, max_time).
+// Em caso de acerto reordena o vetor e repõe os resultados por processo sem
+// simular. 'hit' (opcional) indica se o resultado veio da cache.
+SimulationStats schedule_cached(ResultCache* cache, Process** processes, int count,
+                                SchedulerType type, int quantum, SimTime max_time, bool* hit);
+
+#endif
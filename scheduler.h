@@ -18,20 +18,91 @@ typedef enum {
     PRIORITY_P,     // Prioridade preemptivo
     ROUND_ROBIN,
     RATE_MONOTONIC,
-    EDF
+    EDF,
+    SRTF,           // Shortest Remaining Time First (SJF preemptivo)
+    HRRN            // Highest Response Ratio Next
 } SchedulerType;
 
 
+// Ponto da curva de Round Robin em função do quantum
+typedef struct {
+    int quantum;
+    double avg_waiting_time;
+    double avg_turnaround_time;
+    long long context_switches;    // Mudanças do processo em execução
+    SimTime makespan;              // Instante em que o último processo termina
+} RRQuantumPoint;
+
+
 // Funções de escalonamento
 void fcfs_scheduler(Process** processes, int count);
 void sjf_scheduler(Process** processes, int count);
-void priority_scheduler(Process** processes, int count, bool preemptive);
+void priority_scheduler(Process** processes, int count, bool preemptive, int aging_interval);
 void rr_scheduler(Process** processes, int count, int quantum);
 void rate_monotonic_scheduler(Process** processes, int count);
 void edf_scheduler(Process** processes, int count);
+void srtf_scheduler(Process** processes, int count);
+void hrrn_scheduler(Process** processes, int count);
+
+// Configuração global do processo, lida por schedule(), scheduler_begin()
+// e print_schedule(): não é reentrante, pelo que threads que precisem de
+// valores diferentes devem usar o motor de probsched.h, que recebe o
+// envelhecimento por parâmetro e nunca consulta estas variáveis.
+
+// Envelhecimento de prioridades (unidades de tempo de espera por nível; 0 = desativado)
+void set_priority_aging(int aging_interval);
+int get_priority_aging(void);
+
+// Liga/desliga as mensagens dos escalonadores e a tabela impressa por schedule()
+// (deve ser configurado antes de lançar simulações em várias threads)
+void set_scheduler_verbose(bool verbose);
+bool scheduler_is_verbose(void);
+
+// Nome curto do algoritmo ("fcfs", "sjf", "rr", ...) e conversão inversa
+const char* scheduler_type_name(SchedulerType type);
+bool scheduler_type_from_name(const char* name, SchedulerType* type);
 
 // Função principal de escalonamento
-void schedule(Process** processes, int count, SchedulerType type, int quantum, int max_time);
+void schedule(Process** processes, int count, SchedulerType type, int quantum, SimTime max_time);
+
+// Simulação por etapas: o mesmo que schedule(), mas pode ser interrompida
+// em qualquer instante, copiada para ramos alternativos ou gravada num
+// snapshot (checkpoint.h) e retomada com resultados idênticos.
+typedef struct SchedulerState SchedulerState;
+
+// Repõe os processos, ordena-os para o algoritmo e cria o estado inicial
+SchedulerState* scheduler_begin(Process** processes, int count, SchedulerType type, int quantum);
+
+// Executa decisões até o relógio atingir 'until' (a última decisão pode
+// ultrapassá-lo) ou a simulação terminar. Devolve true quando terminou.
+bool scheduler_run_until(SchedulerState* state, Process** processes, SimTime until);
+bool scheduler_finished(const SchedulerState* state);
+SimTime scheduler_current_time(const SchedulerState* state);
+
+// Cópia independente do estado (os processos têm de ser copiados à parte)
+SchedulerState* scheduler_state_clone(const SchedulerState* state);
+void scheduler_state_free(SchedulerState* state);
+
+// Avalia vários quanta de Round Robin numa só passagem: a ordenação e a
+// extração das chegadas são feitas uma vez e cada quantum corre numa lane
+// paralela com o seu próprio estado. Preenche points[0..quantum_count-1].
+void rr_quantum_sweep(Process** processes, int count, const int* quanta, int quantum_count,
+                      RRQuantumPoint* points);
+void print_rr_quantum_sweep(const RRQuantumPoint* points, int quantum_count);
+
+// Linhas mostradas por print_schedule
+typedef enum {
+    SCHEDULE_ROWS_ALL,          // Todos os processos
+    SCHEDULE_ROWS_SUMMARY,      // Só o resumo
+    SCHEDULE_ROWS_TOP,          // Os K processos com maior tempo de espera
+    SCHEDULE_ROWS_SAMPLE        // K processos espaçados uniformemente
+} ScheduleRows;
+
+// Com K >= número de processos os modos TOP e SAMPLE mostram a tabela completa
+void set_schedule_rows(ScheduleRows mode, int limit);
+
+// Lê "all", "summary", "top:K" ou "sample:K"
+bool parse_schedule_rows(const char* text, ScheduleRows* mode, int* limit);
 
 // Função para imprimir resultados
 void print_schedule(Process** processes, int count);
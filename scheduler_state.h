@@ -0,0 +1,126 @@
+// ----------------------------------------------------------------
+//        Estado interno de uma simulação em curso (por etapas)
+
+//   Só os módulos que precisam de ver o estado por dentro (a gravação
+//   de snapshots, a re-simulação incremental e o motor online) incluem
+//   este ficheiro; o resto usa SchedulerState como tipo opaco através
+//   de scheduler.h.
+// ----------------------------------------------------------------
+
+#ifndef SCHEDULER_STATE_H
+#define SCHEDULER_STATE_H
+
+#include <stdbool.h>
+#include "scheduler.h"
+#include "heap.h"
+
+// Limite de segurança do Rate Monotonic
+#define RM_SIMULATION_LIMIT 1000
+
+// Decisão registada para o motor online (ver probsched.h)
+typedef enum {
+    SCHED_EVENT_RUN,           // Processo executou de 'start' durante 'length'
+    SCHED_EVENT_MISS           // Processo descartado por deadline perdida
+} SchedulerEventType;
+
+typedef struct {
+    SchedulerEventType type;
+    int index;                 // Posição do processo
+    SimTime start;
+    SimTime length;
+    bool completed;            // O processo terminou no fim desta fatia
+} SchedulerEvent;
+
+// Os índices referem-se à posição do processo no vetor ordenado pelo
+// algoritmo. Os campos "derivados" dependem apenas da carga e são
+// reconstruídos ao restaurar; os restantes fazem parte do snapshot.
+struct SchedulerState {
+    SchedulerType type;
+    int quantum;
+    int aging_interval;
+    int count;
+    int capacity;              // Posições alocadas nos vetores por processo
+    bool verbose;              // Mensagens de execução (só schedule() e scheduler_begin as ligam)
+
+    // Relógio e progresso
+    SimTime current_time;
+    int completed;
+    int next_arrival;          // Próxima posição ainda por admitir
+    int first_alive;           // SJF/EDF: início da janela de candidatos
+    SimTime horizon;           // Limite do scheduler_run_until em curso
+    int profile_last;          // Último processo executado (contadores de -DPROFILE)
+
+    // Estado por processo
+    SimTime* remaining;        // Tempo restante
+    int* next;                 // RR: seguinte na lista de prontos
+    SimTime* release;          // RM: próxima ativação
+    Heap ready;                // Prontos (SJF/EDF com N grande, prioridade, SRTF, RM)
+    Heap expiry;               // Prioridade: deadlines por instante limite; RM: ativações
+    bool use_heap;             // SJF/EDF: heap em vez do varrimento (janela grande)
+
+    // Round Robin: lista de prontos e acumuladores
+    int head;
+    int tail;
+    int cursor;                // Próximo processo a executar
+    int prev;                  // Antecessor do cursor na lista
+    int last_run;
+    long long context_switches;
+    long long total_waiting;
+    long long total_turnaround;
+
+    // HRRN: grupos de processos com o mesmo burst (filas ligadas por chegada)
+    int bucket_count;
+    int bucket_capacity;
+    int* bucket_head;          // Próximo membro de cada grupo (-1 = esgotado)
+    int* bucket_listed;        // O grupo está na lista de ativos
+    int* active;               // Grupos ainda com membros (active_count primeiros)
+    int active_count;
+
+    // Derivados da carga
+    SimTime* arrival;
+    SimTime* key;              // SJF/RR: burst; EDF: deadline absoluta
+    int* bucket_of;
+    int* bucket_next;          // Seguinte membro do mesmo grupo
+    SimTime* bucket_burst;
+    int* bucket_tail;
+    int* bucket_table;         // Dispersão burst -> grupo (endereçamento aberto)
+    int bucket_table_size;
+    bool borrowed;             // Os vetores derivados pertencem a outro estado (não são libertados)
+
+    // Registo de decisões por consumir (só com record_events)
+    bool record_events;
+    SchedulerEvent* events;
+    int event_first;
+    int event_count;
+    int event_capacity;
+};
+
+// Cria o estado inicial sobre processos já ordenados pelo algoritmo
+// (não reordena nem repõe os campos de resultado dos processos). Não lê
+// nenhuma configuração global: tudo vem dos parâmetros e as mensagens
+// ficam desligadas.
+SchedulerState* scheduler_state_create(Process** processes, int count, SchedulerType type,
+                                       int quantum, int aging_interval);
+
+// Acrescenta processes[state->count] a um estado em curso. A chegada não
+// pode ser anterior à do último processo nem ao último 'until' simulado.
+// Não serve para Rate Monotonic (ordenado por período).
+void scheduler_state_append(SchedulerState* state, Process** processes);
+
+// Retira os processos terminados ou descartados: os restantes passam para
+// o início de 'processes', pela mesma ordem, e o estado é renumerado sem
+// mudar nenhuma decisão futura. Só é feito sem decisões por consumir (que
+// se referem a posições) e fora do Rate Monotonic; devolve quantos saíram.
+int scheduler_state_compact(SchedulerState* state, Process** processes);
+
+// Passa a partilhar os vetores derivados de 'owner' (mesma carga)
+void scheduler_state_borrow(SchedulerState* state, const SchedulerState* owner);
+
+// Liga o registo de decisões; scheduler_next_event consome-as por ordem
+void scheduler_state_record(SchedulerState* state, bool record);
+bool scheduler_next_event(SchedulerState* state, SchedulerEvent* event);
+
+// Ordem em que o algoritmo percorre os processos
+void scheduler_sort(Process** processes, int count, SchedulerType type);
+
+#endif
@@ -0,0 +1,148 @@
+#include <limits.h>
+#include <pthread.h>
+#include "select.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define SELECT_X86 1
+#endif
+
+typedef int (*ArgminKernel)(const SimTime*, const SimTime*, const SimTime*, int, int, SimTime);
+
+static int argmin_scalar(const SimTime* key, const SimTime* arrival, const SimTime* remaining,
+                         int begin, int end, SimTime now) {
+    int best = -1;
+    SimTime best_key = SIM_TIME_MAX;
+    for (int i = begin; i < end; i++) {
+        if (arrival[i] <= now && remaining[i] > 0 && (best == -1 || key[i] < best_key)) {
+            best = i;
+            best_key = key[i];
+        }
+    }
+    return best;
+}
+
+#ifdef SELECT_X86
+
+// As lanes são de 64 bits: duas por registo SSE, quatro por registo AVX2.
+// As posições também seguem em lanes de 64 bits, ao lado das chaves.
+
+__attribute__((target("sse4.2")))
+static int argmin_sse42(const SimTime* key, const SimTime* arrival, const SimTime* remaining,
+                        int begin, int end, SimTime now) {
+    __m128i best_key = _mm_set1_epi64x(SIM_TIME_MAX);
+    __m128i best_idx = _mm_set1_epi64x(-1);
+    __m128i idx = _mm_set_epi64x(begin + 1, begin);
+    const __m128i step = _mm_set1_epi64x(2);
+    const __m128i vnow = _mm_set1_epi64x(now);
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i none = _mm_set1_epi64x(-1);
+
+    int i = begin;
+    for (; i + 2 <= end; i += 2) {
+        __m128i k = _mm_loadu_si128((const __m128i*)(key + i));
+        __m128i a = _mm_loadu_si128((const __m128i*)(arrival + i));
+        __m128i r = _mm_loadu_si128((const __m128i*)(remaining + i));
+
+        // pronto = !(arrival > now) && remaining > 0; melhor = key < melhor da
+        // lane ou lane ainda vazia (a chave pode ser SIM_TIME_MAX: EDF sem deadline)
+        __m128i ready = _mm_andnot_si128(_mm_cmpgt_epi64(a, vnow), _mm_cmpgt_epi64(r, zero));
+        __m128i lower = _mm_or_si128(_mm_cmpgt_epi64(best_key, k), _mm_cmpeq_epi64(best_idx, none));
+        __m128i better = _mm_and_si128(ready, lower);
+
+        best_key = _mm_blendv_epi8(best_key, k, better);
+        best_idx = _mm_blendv_epi8(best_idx, idx, better);
+        idx = _mm_add_epi64(idx, step);
+    }
+
+    long long keys[2], idxs[2];
+    _mm_storeu_si128((__m128i*)keys, best_key);
+    _mm_storeu_si128((__m128i*)idxs, best_idx);
+
+    // Redução entre lanes: menor chave, e em empate menor posição
+    int best = argmin_scalar(key, arrival, remaining, i, end, now);
+    SimTime best_value = best >= 0 ? key[best] : SIM_TIME_MAX;
+    for (int lane = 0; lane < 2; lane++) {
+        if (idxs[lane] < 0) continue;
+        if (best == -1 || keys[lane] < best_value || (keys[lane] == best_value && idxs[lane] < best)) {
+            best = (int)idxs[lane];
+            best_value = keys[lane];
+        }
+    }
+    return best;
+}
+
+__attribute__((target("avx2")))
+static int argmin_avx2(const SimTime* key, const SimTime* arrival, const SimTime* remaining,
+                       int begin, int end, SimTime now) {
+    __m256i best_key = _mm256_set1_epi64x(SIM_TIME_MAX);
+    __m256i best_idx = _mm256_set1_epi64x(-1);
+    __m256i idx = _mm256_add_epi64(_mm256_set1_epi64x(begin), _mm256_setr_epi64x(0, 1, 2, 3));
+    const __m256i step = _mm256_set1_epi64x(4);
+    const __m256i vnow = _mm256_set1_epi64x(now);
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i none = _mm256_set1_epi64x(-1);
+
+    int i = begin;
+    for (; i + 4 <= end; i += 4) {
+        __m256i k = _mm256_loadu_si256((const __m256i*)(key + i));
+        __m256i a = _mm256_loadu_si256((const __m256i*)(arrival + i));
+        __m256i r = _mm256_loadu_si256((const __m256i*)(remaining + i));
+
+        __m256i ready = _mm256_andnot_si256(_mm256_cmpgt_epi64(a, vnow),
+                                            _mm256_cmpgt_epi64(r, zero));
+        __m256i lower = _mm256_or_si256(_mm256_cmpgt_epi64(best_key, k),
+                                        _mm256_cmpeq_epi64(best_idx, none));
+        __m256i better = _mm256_and_si256(ready, lower);
+
+        best_key = _mm256_blendv_epi8(best_key, k, better);
+        best_idx = _mm256_blendv_epi8(best_idx, idx, better);
+        idx = _mm256_add_epi64(idx, step);
+    }
+
+    long long keys[4], idxs[4];
+    _mm256_storeu_si256((__m256i*)keys, best_key);
+    _mm256_storeu_si256((__m256i*)idxs, best_idx);
+
+    int best = argmin_scalar(key, arrival, remaining, i, end, now);
+    SimTime best_value = best >= 0 ? key[best] : SIM_TIME_MAX;
+    for (int lane = 0; lane < 4; lane++) {
+        if (idxs[lane] < 0) continue;
+        if (best == -1 || keys[lane] < best_value || (keys[lane] == best_value && idxs[lane] < best)) {
+            best = (int)idxs[lane];
+            best_value = keys[lane];
+        }
+    }
+    return best;
+}
+
+#endif
+
+static ArgminKernel selected_kernel = argmin_scalar;
+static const char* selected_name = "scalar";
+static pthread_once_t dispatch_once = PTHREAD_ONCE_INIT;
+
+// Escolhe a implementação uma única vez conforme as capacidades do CPU
+static void resolve_kernel(void) {
+#ifdef SELECT_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        selected_kernel = argmin_avx2;
+        selected_name = "avx2";
+    } else if (__builtin_cpu_supports("sse4.2")) {
+        selected_kernel = argmin_sse42;
+        selected_name = "sse4.2";
+    }
+#endif
+}
+
+int masked_argmin(const SimTime* key, const SimTime* arrival, const SimTime* remaining,
+                  int begin, int end, SimTime now) {
+    pthread_once(&dispatch_once, resolve_kernel);
+    return selected_kernel(key, arrival, remaining, begin, end, now);
+}
+
+const char* masked_argmin_implementation(void) {
+    pthread_once(&dispatch_once, resolve_kernel);
+    return selected_name;
+}
@@ -0,0 +1,30 @@
+// ----------------------------------------------------------------
+//   Seleção vetorizada (SIMD) do próximo processo a executar
+
+//   Os dados são lidos em formato structure-of-arrays (um vetor por
+//   campo, tempos de 64 bits) e a versão AVX2/SSE4.2/escalar é
+//   escolhida em tempo de execução conforme o CPU
+// ----------------------------------------------------------------
+
+#ifndef SELECT_H
+#define SELECT_H
+
+#include "process.h"
+
+// Até este número de candidatos (janela de processos já chegados e por
+// terminar) compensa varrer os vetores com SIMD; acima disso os
+// escalonadores usam o heap. Medido com AVX2 e -O2: o varrimento custa
+// cerca de 2 ns por candidato e um pop + push no heap 40-200 ns, pelo que
+// as curvas cruzam-se entre 16 e 32 candidatos.
+#define SIMD_SELECT_LIMIT 32
+
+// Devolve a posição i em [begin, end) com menor key[i] entre os processos
+// prontos (arrival[i] <= now && remaining[i] > 0). Em empate devolve a
+// menor posição. Devolve -1 se nenhum processo estiver pronto.
+int masked_argmin(const SimTime* key, const SimTime* arrival, const SimTime* remaining,
+                  int begin, int end, SimTime now);
+
+// Nome da implementação escolhida ("avx2", "sse4.2" ou "scalar")
+const char* masked_argmin_implementation(void);
+
+#endif
@@ -0,0 +1,238 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include "sort.h"
+#include "parallel.h"
+
+#define RADIX_BITS 8
+#define RADIX_BUCKETS (1 << RADIX_BITS)
+#define RADIX_PASSES (64 / RADIX_BITS)
+
+// A partir deste tamanho a contagem e a distribuição são feitas em paralelo
+#define PARALLEL_SORT_THRESHOLD (1 << 18)
+
+typedef struct {
+    unsigned long long key;
+    Process* process;
+} SortEntry;
+
+// As funções SORT_INLINE são sempre expandidas com a chave constante: cada
+// instância fica sem o switch de extract_key dentro dos ciclos
+#define SORT_INLINE static inline __attribute__((always_inline))
+
+// Converte a chave com sinal para uma chave sem sinal com a mesma ordem
+SORT_INLINE unsigned long long extract_key(const Process* p, SortKey key) {
+    long long value;
+    switch (key) {
+        case SORT_BY_PERIOD:
+            value = p->period;
+            break;
+        case SORT_BY_DEADLINE:
+            value = (long long)p->arrival_time + p->deadline;
+            break;
+        case SORT_BY_ARRIVAL:
+        default:
+            value = p->arrival_time;
+            break;
+    }
+    return (unsigned long long)value ^ (1ULL << 63);
+}
+
+SORT_INLINE void fill_entries_by(Process** processes, int begin, int end, SortKey key,
+                                 SortEntry* out) {
+    for (int i = begin; i < end; i++) {
+        out[i].key = extract_key(processes[i], key);
+        out[i].process = processes[i];
+    }
+}
+
+SORT_INLINE bool is_sorted_by(Process** processes, int count, SortKey key) {
+    unsigned long long previous = extract_key(processes[0], key);
+    for (int i = 1; i < count; i++) {
+        unsigned long long current = extract_key(processes[i], key);
+        if (current < previous) return false;
+        previous = current;
+    }
+    return true;
+}
+
+// Entradas (chave, processo) das posições [begin, end)
+static void fill_entries(Process** processes, int begin, int end, SortKey key, SortEntry* out) {
+    switch (key) {
+        case SORT_BY_PERIOD:   fill_entries_by(processes, begin, end, SORT_BY_PERIOD, out); break;
+        case SORT_BY_DEADLINE: fill_entries_by(processes, begin, end, SORT_BY_DEADLINE, out); break;
+        default:               fill_entries_by(processes, begin, end, SORT_BY_ARRIVAL, out); break;
+    }
+}
+
+static bool is_sorted(Process** processes, int count, SortKey key) {
+    switch (key) {
+        case SORT_BY_PERIOD:   return is_sorted_by(processes, count, SORT_BY_PERIOD);
+        case SORT_BY_DEADLINE: return is_sorted_by(processes, count, SORT_BY_DEADLINE);
+        default:               return is_sorted_by(processes, count, SORT_BY_ARRIVAL);
+    }
+}
+
+static inline int digit_of(unsigned long long key, int pass) {
+    return (int)((key >> (pass * RADIX_BITS)) & (RADIX_BUCKETS - 1));
+}
+
+// ---------------- Versão paralela ----------------
+
+// Uma só equipa de threads faz a extração e todas as passagens; cada
+// thread trata sempre o mesmo bloco e as fases são separadas por barreiras
+typedef struct {
+    Process** processes;
+    SortEntry* src;
+    SortEntry* dst;
+    int count;
+    SortKey key;
+    int (*histograms)[RADIX_BUCKETS];   // [bloco][dígito], reutilizado como offsets
+    bool trivial;                       // Passagem atual desnecessária
+} ParallelSort;
+
+static void chunk_bounds(const ParallelSort* ps, int chunk, int chunks, int* begin, int* end) {
+    long long size = ps->count;
+    *begin = (int)(size * chunk / chunks);
+    *end = (int)(size * (chunk + 1) / chunks);
+}
+
+// Offsets por dígito e, dentro do dígito, por bloco (mantém estabilidade)
+static void prefix_offsets(ParallelSort* ps, int chunks) {
+    int total = 0;
+    ps->trivial = false;
+    for (int d = 0; d < RADIX_BUCKETS; d++) {
+        int digit_total = 0;
+        for (int c = 0; c < chunks; c++) {
+            digit_total += ps->histograms[c][d];
+        }
+        if (digit_total == ps->count) {
+            ps->trivial = true;   // Todos com o mesmo dígito: passagem desnecessária
+            return;
+        }
+        for (int c = 0; c < chunks; c++) {
+            int n = ps->histograms[c][d];
+            ps->histograms[c][d] = total;
+            total += n;
+        }
+    }
+}
+
+static void radix_member(ParallelTeam* team, int chunk, void* ctx) {
+    ParallelSort* ps = (ParallelSort*)ctx;
+    int chunks = parallel_team_size(team);
+    int begin, end;
+    chunk_bounds(ps, chunk, chunks, &begin, &end);
+    int* histogram = ps->histograms[chunk];
+    SortEntry* src = ps->src;
+    SortEntry* dst = ps->dst;
+
+    fill_entries(ps->processes, begin, end, ps->key, src);
+
+    for (int pass = 0; pass < RADIX_PASSES; pass++) {
+        memset(histogram, 0, RADIX_BUCKETS * sizeof(int));
+        for (int i = begin; i < end; i++) {
+            histogram[digit_of(src[i].key, pass)]++;
+        }
+        parallel_team_barrier(team);
+
+        if (chunk == 0) prefix_offsets(ps, chunks);
+        parallel_team_barrier(team);
+        if (ps->trivial) continue;
+
+        for (int i = begin; i < end; i++) {
+            dst[histogram[digit_of(src[i].key, pass)]++] = src[i];
+        }
+        SortEntry* tmp = src;
+        src = dst;
+        dst = tmp;
+        parallel_team_barrier(team);
+    }
+
+    for (int i = begin; i < end; i++) {
+        ps->processes[i] = src[i].process;
+    }
+}
+
+static void parallel_radix_sort(Process** processes, int count, SortKey key,
+                                SortEntry* src, SortEntry* dst, int threads) {
+    ParallelSort ps;
+    ps.processes = processes;
+    ps.src = src;
+    ps.dst = dst;
+    ps.count = count;
+    ps.key = key;
+    ps.trivial = false;
+    ps.histograms = malloc(threads * sizeof(*ps.histograms));
+    if (ps.histograms == NULL) {
+        perror("Erro ao alocar memória para ordenação");
+        exit(EXIT_FAILURE);
+    }
+
+    parallel_team(threads, radix_member, &ps);
+    free(ps.histograms);
+}
+
+// ---------------- Versão sequencial ----------------
+
+static void sequential_radix_sort(Process** processes, int count, SortKey key,
+                                  SortEntry* src, SortEntry* dst) {
+    // Histogramas de todos os dígitos numa única passagem
+    int histograms[RADIX_PASSES][RADIX_BUCKETS];
+    memset(histograms, 0, sizeof(histograms));
+
+    fill_entries(processes, 0, count, key, src);
+    for (int i = 0; i < count; i++) {
+        for (int pass = 0; pass < RADIX_PASSES; pass++) {
+            histograms[pass][digit_of(src[i].key, pass)]++;
+        }
+    }
+
+    for (int pass = 0; pass < RADIX_PASSES; pass++) {
+        int* histogram = histograms[pass];
+        if (histogram[digit_of(src[0].key, pass)] == count) {
+            continue;   // Dígito constante em todas as chaves
+        }
+
+        int total = 0;
+        for (int d = 0; d < RADIX_BUCKETS; d++) {
+            int n = histogram[d];
+            histogram[d] = total;
+            total += n;
+        }
+        for (int i = 0; i < count; i++) {
+            dst[histogram[digit_of(src[i].key, pass)]++] = src[i];
+        }
+
+        SortEntry* tmp = src;
+        src = dst;
+        dst = tmp;
+    }
+
+    for (int i = 0; i < count; i++) {
+        processes[i] = src[i].process;
+    }
+}
+
+void sort_processes(Process** processes, int count, SortKey key) {
+    if (count <= 1) return;
+
+    // Vetor já ordenado (o gerador produz chegadas crescentes): nada a fazer
+    if (is_sorted(processes, count, key)) return;
+
+    SortEntry* buffers = (SortEntry*)malloc(2 * (size_t)count * sizeof(SortEntry));
+    if (buffers == NULL) {
+        perror("Erro ao alocar memória para ordenação");
+        exit(EXIT_FAILURE);
+    }
+
+    int threads = parallel_thread_count();
+    if (count >= PARALLEL_SORT_THRESHOLD && threads > 1) {
+        parallel_radix_sort(processes, count, key, buffers, buffers + count, threads);
+    } else {
+        sequential_radix_sort(processes, count, key, buffers, buffers + count);
+    }
+
+    free(buffers);
+}
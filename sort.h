@@ -0,0 +1,23 @@
+// ----------------------------------------------------------------
+//     Ordenação dos processos por chave inteira (radix sort LSD)
+
+//   Estável: processos com a mesma chave mantêm a ordem de entrada
+//   (desempate determinístico, por exemplo no FCFS)
+// ----------------------------------------------------------------
+
+#ifndef SORT_H
+#define SORT_H
+
+#include "process.h"
+
+typedef enum {
+    SORT_BY_ARRIVAL,    // arrival_time
+    SORT_BY_PERIOD,     // period
+    SORT_BY_DEADLINE    // arrival_time + deadline
+} SortKey;
+
+// Ordena o vetor de processos pela chave indicada.
+// Se o vetor já estiver ordenado não faz nada (caso típico do gerador).
+void sort_processes(Process** processes, int count, SortKey key);
+
+#endif
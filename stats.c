@@ -2,22 +2,24 @@
 #include <stdlib.h>
 #include <math.h>
 #include "stats.h"
+#include "profile.h"
 
-SimulationStats calculate_stats(Process** processes, int count, int total_time) {
+SimulationStats calculate_stats(Process** processes, int count, SimTime total_time) {
     SimulationStats stats = {0};
     if (count == 0 || total_time == 0) {
         return stats;
     }
 
+    PROFILE_PHASE_BEGIN();
     double total_waiting = 0;
     double total_turnaround = 0;
     double total_response = 0;  // Declaração adicionada aqui
-    int total_burst = 0;
+    SimTime total_burst = 0;
     stats.deadline_misses = 0;
 
     for (int i = 0; i < count; i++) {
-        int turnaround = processes[i]->completion_time - processes[i]->arrival_time;
-        int waiting = turnaround - processes[i]->burst_time;
+        SimTime turnaround = processes[i]->completion_time - processes[i]->arrival_time;
+        SimTime waiting = turnaround - processes[i]->burst_time;
         
         total_waiting += waiting;
         total_turnaround += turnaround;
@@ -40,12 +42,14 @@ SimulationStats calculate_stats(Process** processes, int count, int total_time)
     stats.cpu_utilization = (total_burst * 100.0) / total_time;
     stats.throughput = count / (double)total_time;
 
+    PROFILE_PHASE_END(PROFILE_STATS);
     return stats;
 }
 
 
 
 void print_stats(SimulationStats stats) {
+    PROFILE_PHASE_BEGIN();
     printf("\n=== Estatísticas da Simulação ===\n");
     printf("Tempo médio de espera:    %.2f unidades de tempo\n", stats.avg_waiting_time);
     printf("Tempo médio de retorno:   %.2f unidades de tempo\n", stats.avg_turnaround_time);
@@ -54,18 +58,19 @@ void print_stats(SimulationStats stats) {
     printf("Throughput:               %.2f processos/unidade de tempo\n", stats.throughput);
     
     if (stats.deadline_misses > 0) {
-        printf("Deadlines perdidas:       %d\n", stats.deadline_misses);
+        printf("Deadlines perdidas:       %lld\n", stats.deadline_misses);
     }
     
     printf("================================\n");
+    PROFILE_PHASE_END(PROFILE_OUTPUT);
 }
 
 
 
-void calculate_process_stats(Process* process, int total_time) {
+void calculate_process_stats(Process* process, SimTime total_time) {
     // Variáveis usadas apenas para cálculo temporário
-    int turnaround = process->completion_time - process->arrival_time;
-    int waiting = turnaround - process->burst_time;
+    SimTime turnaround = process->completion_time - process->arrival_time;
+    SimTime waiting = turnaround - process->burst_time;
     double response_ratio = (double)turnaround / process->burst_time;
     
     // Aqui você pode usar essas variáveis se necessário
@@ -94,7 +99,7 @@ void print_comparative_stats(SimulationStats stats[], char* algorithm_names[], i
                stats[i].throughput);
         
         if (stats[i].deadline_misses > 0) {
-            printf("%-10d\n", stats[i].deadline_misses);
+            printf("%-10lld\n", stats[i].deadline_misses);
         } else {
             printf("%-10s\n", "N/A");
         }
@@ -0,0 +1,349 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <limits.h>
+#include "steady.h"
+#include "probsched.h"
+
+// Observações antes do primeiro teste e crescimento entre testes (o MSER-5
+// percorre a série toda, por isso os testes ficam cada vez mais espaçados)
+#define STEADY_FIRST_CHECK 2000
+#define STEADY_CHECK_GROWTH 8       // Próximo teste com mais 1/8 de observações
+#define MSER_BATCH 5
+#define STEADY_MAX_LOAD 1.0         // Carga oferecida a partir da qual não há regime estacionário
+#define STEADY_DEFAULT_LOAD 0.8
+#define STEADY_PILOT_JOBS 100000    // Amostra para estimar a carga das distribuições
+
+// Uma observação por processo terminado ou descartado, por ordem de saída
+typedef struct {
+    double* waiting;
+    double* turnaround;
+    double* response;
+    unsigned char* missed;
+    SimTime* time;             // Instante da saída
+    SimTime* busy;             // CPU ocupada acumulada até essa saída
+    long long count;
+    long long capacity;
+} Observations;
+
+// Dados de cada job enquanto está no sistema (indexados pelo id)
+typedef struct {
+    SimTime* arrival;
+    SimTime* deadline;         // Relativa (0 = sem deadline)
+    SimTime* first_start;      // -1 = ainda não executou
+    SimTime* executed;
+    long long capacity;
+} JobTable;
+
+static void* steady_alloc(void* pointer, size_t size) {
+    pointer = realloc(pointer, size);
+    if (pointer == NULL) {
+        perror("Erro ao alocar memória para o regime estacionário");
+        exit(EXIT_FAILURE);
+    }
+    return pointer;
+}
+
+static void observations_reserve(Observations* obs) {
+    if (obs->count < obs->capacity) return;
+    obs->capacity = obs->capacity ? obs->capacity * 2 : 4096;
+    size_t n = (size_t)obs->capacity;
+    obs->waiting = (double*)steady_alloc(obs->waiting, n * sizeof(double));
+    obs->turnaround = (double*)steady_alloc(obs->turnaround, n * sizeof(double));
+    obs->response = (double*)steady_alloc(obs->response, n * sizeof(double));
+    obs->missed = (unsigned char*)steady_alloc(obs->missed, n);
+    obs->time = (SimTime*)steady_alloc(obs->time, n * sizeof(SimTime));
+    obs->busy = (SimTime*)steady_alloc(obs->busy, n * sizeof(SimTime));
+}
+
+static void jobs_reserve(JobTable* jobs, long long id) {
+    if (id < jobs->capacity) return;
+    long long capacity = jobs->capacity ? jobs->capacity : 4096;
+    while (capacity <= id) capacity *= 2;
+    size_t n = (size_t)capacity;
+    jobs->arrival = (SimTime*)steady_alloc(jobs->arrival, n * sizeof(SimTime));
+    jobs->deadline = (SimTime*)steady_alloc(jobs->deadline, n * sizeof(SimTime));
+    jobs->first_start = (SimTime*)steady_alloc(jobs->first_start, n * sizeof(SimTime));
+    jobs->executed = (SimTime*)steady_alloc(jobs->executed, n * sizeof(SimTime));
+    jobs->capacity = capacity;
+}
+
+// Consome as decisões já tomadas pelo motor e regista as saídas
+static void collect(ProbSchedEngine* engine, JobTable* jobs, Observations* obs, SimTime* busy) {
+    ProbSchedDispatch d;
+    while (probsched_next_dispatch(engine, &d)) {
+        int id = d.job_id;
+        SimTime end = d.start_time + d.duration;
+        if (d.type == PROBSCHED_RUN) {
+            if (jobs->first_start[id] < 0) jobs->first_start[id] = d.start_time;
+            jobs->executed[id] += d.duration;
+            *busy += d.duration;
+            if (!d.completed) continue;
+        }
+
+        // Um descarte conta como saída no instante em que acontece
+        SimTime arrival = jobs->arrival[id];
+        SimTime turnaround = end - arrival;
+        observations_reserve(obs);
+        long long k = obs->count++;
+        obs->turnaround[k] = (double)turnaround;
+        obs->waiting[k] = (double)(turnaround - jobs->executed[id]);
+        obs->response[k] = (double)((jobs->first_start[id] >= 0 ? jobs->first_start[id] : end) - arrival);
+        obs->missed[k] = d.type == PROBSCHED_DEADLINE_MISS ||
+                         (jobs->deadline[id] > 0 && turnaround > jobs->deadline[id]);
+        obs->time[k] = end;
+        obs->busy[k] = *busy;
+    }
+}
+
+// MSER-5: corte (em observações) que minimiza a variância estimada da
+// média das observações restantes, ou -1 se o mínimo estiver na
+// fronteira da procura (transitório ainda a decorrer)
+static long long mser5(const double* series, long long count) {
+    long long m = count / MSER_BATCH;
+    if (m < 4) return -1;
+    double* z = (double*)steady_alloc(NULL, (size_t)m * sizeof(double));
+    for (long long j = 0; j < m; j++) {
+        double sum = 0.0;
+        for (int i = 0; i < MSER_BATCH; i++) sum += series[j * MSER_BATCH + i];
+        z[j] = sum / MSER_BATCH;
+    }
+
+    // Somas do fim para o início: para cada d, média e desvios de z[d..m-1]
+    long long limit = m / 2;
+    long long best = 0;
+    double best_value = INFINITY;
+    double sum = 0.0, sum_sq = 0.0;
+    for (long long d = m - 1; d >= 0; d--) {
+        sum += z[d];
+        sum_sq += z[d] * z[d];
+        if (d > limit) continue;
+        double n = (double)(m - d);
+        double deviations = sum_sq - sum * sum / n;
+        if (deviations < 0.0) deviations = 0.0;
+        double value = deviations / (n * n);
+        if (value <= best_value) {
+            best_value = value;
+            best = d;
+        }
+    }
+    free(z);
+    return best == limit ? -1 : best * MSER_BATCH;
+}
+
+static MetricEstimate batch_means(const double* series, long long first, long long batch_size,
+                                  int batches, double confidence) {
+    double mean = 0.0, m2 = 0.0;
+    for (int b = 0; b < batches; b++) {
+        const double* batch = series + first + (long long)b * batch_size;
+        double sum = 0.0;
+        for (long long i = 0; i < batch_size; i++) sum += batch[i];
+        double value = sum / batch_size;
+        double delta = value - mean;
+        mean += delta / (b + 1);
+        m2 += delta * (value - mean);
+    }
+    MetricEstimate e;
+    e.mean = mean;
+    e.stddev = sqrt(m2 / (batches - 1));
+    e.half_width = student_t_quantile(confidence, batches - 1) * e.stddev / sqrt((double)batches);
+    return e;
+}
+
+// Corta o aquecimento, estima por lotes e diz se a precisão foi atingida
+static bool analyse(const SteadyConfig* config, const Observations* obs, SteadyResult* result) {
+    long long n = obs->count;
+    result->observations = n;
+    result->warmup = mser5(obs->waiting, n);
+    if (result->warmup < 0) return false;
+
+    int k = config->batches;
+    long long batch_size = (n - result->warmup) / k;
+    if (batch_size < 1) return false;
+    result->batch_size = batch_size;
+
+    // O resto da divisão sai do início, junto ao aquecimento
+    long long first = n - batch_size * k;
+    double* missed = (double*)steady_alloc(NULL, (size_t)(n - first) * sizeof(double));
+    for (long long i = first; i < n; i++) {
+        missed[i - first] = obs->missed[i];
+    }
+    result->avg_waiting_time = batch_means(obs->waiting, first, batch_size, k, config->confidence);
+    result->avg_turnaround_time = batch_means(obs->turnaround, first, batch_size, k, config->confidence);
+    result->avg_response_time = batch_means(obs->response, first, batch_size, k, config->confidence);
+    result->deadline_miss_ratio = batch_means(missed, 0, batch_size, k, config->confidence);
+    free(missed);
+
+    // Médias temporais na janela depois do corte
+    SimTime span = obs->time[n - 1] - obs->time[first];
+    if (span > 0) {
+        result->throughput = (double)(n - 1 - first) / span;
+        result->cpu_utilization = 100.0 * (obs->busy[n - 1] - obs->busy[first]) / span;
+    }
+    double target = config->target_precision, absolute = config->absolute_precision;
+    return estimate_precise_enough(result->avg_waiting_time, target, absolute) &&
+           estimate_precise_enough(result->avg_turnaround_time, target, absolute) &&
+           estimate_precise_enough(result->avg_response_time, target, absolute) &&
+           estimate_precise_enough(result->deadline_miss_ratio, target, absolute);
+}
+
+// Multiplicador dos intervalos entre chegadas que leva a carga oferecida
+// das distribuições (burst médio / intervalo médio, numa amostra piloto
+// com a mesma seed) ao valor pedido
+static double arrival_scale_for(const SteadyConfig* config) {
+    if (config->load <= 0.0) return 1.0;
+    ProcessStream pilot;
+    process_stream_init(&pilot, config->arrival_dist, config->burst_dist, config->seed, 1.0);
+    SimTime total_burst = 0;
+    Process p;
+    for (int k = 0; k < STEADY_PILOT_JOBS; k++) {
+        process_stream_next(&pilot, &p);
+        total_burst += p.burst_time;
+    }
+    if (pilot.time <= 0) return 1.0;
+    return ((double)total_burst / pilot.time) / config->load;
+}
+
+SteadyConfig default_steady_config(const ReplicationConfig* batch) {
+    SteadyConfig config;
+    config.type = batch->type;
+    config.quantum = batch->quantum;
+    config.arrival_dist = batch->arrival_dist;
+    config.burst_dist = batch->burst_dist;
+    config.seed = batch->seed;
+    config.load = STEADY_DEFAULT_LOAD;
+    config.max_jobs = 1000000;
+    config.batches = 30;
+    config.target_precision = batch->target_precision;
+    config.absolute_precision = batch->absolute_precision;
+    config.confidence = batch->confidence;
+    return config;
+}
+
+bool run_steady_state(const SteadyConfig* config, SteadyResult* result) {
+    memset(result, 0, sizeof(SteadyResult));
+    result->warmup = -1;
+    if (config->type == RATE_MONOTONIC || config->batches < 2 || config->load < 0.0 ||
+        config->max_jobs <= 0 || config->max_jobs >= INT_MAX) {
+        return false;
+    }
+    ProbSchedEngine* engine = probsched_create(config->type, config->quantum, get_priority_aging());
+    if (engine == NULL) return false;
+
+    ProcessStream source;
+    result->arrival_scale = arrival_scale_for(config);
+    process_stream_init(&source, config->arrival_dist, config->burst_dist, config->seed,
+                        result->arrival_scale);
+    Observations obs;
+    memset(&obs, 0, sizeof(obs));
+    JobTable jobs;
+    memset(&jobs, 0, sizeof(jobs));
+    SimTime busy = 0;
+    SimTime total_burst = 0;
+    long long next_check = STEADY_FIRST_CHECK;
+
+    while (result->jobs < config->max_jobs) {
+        Process p;
+        process_stream_next(&source, &p);
+
+        // Decisões até à chegada; as saídas entretanto viram observações
+        probsched_advance_to(engine, p.arrival_time);
+        collect(engine, &jobs, &obs, &busy);
+
+        jobs_reserve(&jobs, p.pid);
+        jobs.arrival[p.pid] = p.arrival_time;
+        jobs.deadline[p.pid] = p.original_deadline;
+        jobs.first_start[p.pid] = -1;
+        jobs.executed[p.pid] = 0;
+        ProbSchedJob job = { p.pid, p.arrival_time, p.burst_time, p.priority,
+                             p.original_deadline, p.period };
+        if (!probsched_submit(engine, &job)) {
+            // Só acontece com um período fora dos limites do motor
+            continue;
+        }
+        result->jobs++;
+        total_burst += p.burst_time;
+        result->end_time = p.arrival_time;
+
+        // A fila cresce sem limite: nenhum corte dá um regime estacionário.
+        // Testa-se pelos processos gerados porque numa carga destas podem
+        // quase não sair observações.
+        if (result->jobs % STEADY_FIRST_CHECK == 0 &&
+            (double)total_burst / result->end_time >= STEADY_MAX_LOAD) {
+            result->overloaded = true;
+            break;
+        }
+        if (obs.count >= next_check) {
+            if (analyse(config, &obs, result)) {
+                result->converged = true;
+                break;
+            }
+            next_check = obs.count + obs.count / STEADY_CHECK_GROWTH;
+        }
+    }
+    if (result->end_time > 0) result->offered_load = (double)total_burst / result->end_time;
+    if (result->offered_load >= STEADY_MAX_LOAD) result->overloaded = true;
+    if (result->overloaded) {
+        result->observations = obs.count;
+        result->warmup = -1;
+        result->converged = false;
+    } else if (!result->converged) {
+        analyse(config, &obs, result);
+    }
+
+    probsched_destroy(engine);
+    free(obs.waiting);
+    free(obs.turnaround);
+    free(obs.response);
+    free(obs.missed);
+    free(obs.time);
+    free(obs.busy);
+    free(jobs.arrival);
+    free(jobs.deadline);
+    free(jobs.first_start);
+    free(jobs.executed);
+    return true;
+}
+
+static void print_estimate(const char* name, MetricEstimate e) {
+    printf("%-26s %12.4f ± %-10.4f (desvio padrão %.4f)\n", name, e.mean, e.half_width, e.stddev);
+}
+
+void print_steady_result(const SteadyConfig* config, const SteadyResult* result) {
+    printf("\n=== Regime Estacionário (%s) ===\n", scheduler_type_name(config->type));
+    const char* outcome = result->converged ? "precisão atingida"
+                        : result->overloaded ? "interrompido por sobrecarga"
+                        : "limite de processos atingido";
+    printf("Processos:                %lld gerados, %lld terminados (%s)\n",
+           result->jobs, result->observations, outcome);
+    if (config->load > 0.0) {
+        printf("Carga oferecida:          %.3f (pedida %.3f, intervalos entre chegadas x%.3f)\n",
+               result->offered_load, config->load, result->arrival_scale);
+    } else {
+        printf("Carga oferecida:          %.3f\n", result->offered_load);
+    }
+    if (result->overloaded) {
+        printf("Sem regime estacionário:  a carga excede a capacidade do processador\n");
+        printf("                          (a fila cresce sem limite; nenhuma estimativa é válida)\n");
+        printf("================================\n");
+        return;
+    }
+    if (result->warmup < 0) {
+        printf("Aquecimento:              não detetado (sem regime estacionário até t=%lld)\n",
+               result->end_time);
+        printf("================================\n");
+        return;
+    }
+    printf("Aquecimento (MSER-5):     %lld observações descartadas\n", result->warmup);
+    printf("Lotes:                    %d de %lld observações\n", config->batches, result->batch_size);
+    printf("Confiança:                %.0f%%, precisão pedida ±%.1f%% da média (ou ±%g)\n",
+           config->confidence * 100.0, config->target_precision * 100.0, config->absolute_precision);
+    print_estimate("Tempo médio de espera:", result->avg_waiting_time);
+    print_estimate("Tempo médio de retorno:", result->avg_turnaround_time);
+    print_estimate("Tempo médio de resposta:", result->avg_response_time);
+    print_estimate("Fração de deadlines:", result->deadline_miss_ratio);
+    printf("Utilização da CPU:        %.2f%%\n", result->cpu_utilization);
+    printf("Throughput:               %.4f processos/unidade de tempo\n", result->throughput);
+    printf("================================\n");
+}
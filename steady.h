@@ -0,0 +1,84 @@
+// ----------------------------------------------------------------
+//        Regime estacionário: aquecimento e médias por lotes
+
+//   Em vez de uma carga fixa até max_time, o gerador de sistema aberto
+//   alimenta o motor online sem fim e cada processo terminado (ou
+//   descartado) dá uma observação. Periodicamente:
+//
+//     1. o MSER-5 escolhe quantas observações iniciais descartar
+//        (transitório de arranque): médias de 5 observações seguidas e
+//        o ponto de corte d que minimiza a variância da média do resto,
+//        procurado na primeira metade da série. Um mínimo na fronteira
+//        significa que o aquecimento ainda não acabou;
+//     2. o resto divide-se em K lotes iguais; as médias dos lotes são
+//        aproximadamente independentes e dão o intervalo de confiança
+//        (t de Student com K-1 graus de liberdade).
+//
+//   A execução pára assim que as meias-larguras dos tempos de espera,
+//   de retorno e de resposta e da fração de deadlines perdidas ficam
+//   dentro da precisão pedida (relativa, ou absoluta para médias perto
+//   de zero, como nas replicações), ou ao fim de max_jobs processos.
+//
+//   Com as taxas das distribuições do gerador a maior parte das
+//   combinações pede mais CPU do que existe (a carga por omissão,
+//   chegadas exponenciais e bursts normais, é cerca de 3.4). Por isso os
+//   intervalos entre chegadas são escalados para a carga oferecida
+//   pedida em 'load', medida numa amostra piloto da mesma seed; com
+//   load = 0 usam-se as taxas do gerador.
+//
+//   Numa carga com utilização >= 1 não há regime estacionário: a
+//   execução pára no primeiro teste em que a carga oferecida chega a 1
+//   e não dá estimativas (o MSER-5 pode mesmo assim
+//   encontrar um corte, por exemplo no SJF, em que só os processos curtos
+//   saem e os longos esperam sem fim).
+// ----------------------------------------------------------------
+
+#ifndef STEADY_H
+#define STEADY_H
+
+#include <stdbool.h>
+#include "process.h"
+#include "scheduler.h"
+#include "replication.h"
+
+typedef struct {
+    SchedulerType type;            // Todos menos o Rate Monotonic (ativações periódicas fixas)
+    int quantum;
+    DistributionType arrival_dist;
+    DistributionType burst_dist;
+    unsigned long long seed;
+    double load;                   // Carga oferecida pretendida (0 = taxas do gerador)
+    long long max_jobs;            // Limite de processos gerados
+    int batches;                   // K, número de lotes
+    double target_precision;       // Meia-largura máxima relativa à média
+    double absolute_precision;     // Meia-largura sempre aceite (médias perto de zero)
+    double confidence;
+} SteadyConfig;
+
+typedef struct {
+    long long jobs;                // Processos gerados
+    long long observations;        // Processos terminados ou descartados
+    long long warmup;              // Observações descartadas (-1 = aquecimento não detetado)
+    long long batch_size;
+    bool converged;                // true se a precisão pedida foi atingida
+    bool overloaded;               // Carga oferecida >= 1: sem estimativas
+    double arrival_scale;          // Multiplicador dos intervalos entre chegadas
+    double offered_load;           // Soma dos bursts / última chegada
+    SimTime end_time;              // Última chegada gerada
+    MetricEstimate avg_waiting_time;
+    MetricEstimate avg_turnaround_time;
+    MetricEstimate avg_response_time;
+    MetricEstimate deadline_miss_ratio;
+    double cpu_utilization;        // Percentagem, depois do aquecimento
+    double throughput;             // Processos por unidade de tempo, depois do aquecimento
+} SteadyResult;
+
+// Configuração por omissão (a partir das opções das replicações)
+SteadyConfig default_steady_config(const ReplicationConfig* batch);
+
+// Devolve false se a configuração for inválida
+bool run_steady_state(const SteadyConfig* config, SteadyResult* result);
+
+void print_steady_result(const SteadyConfig* config, const SteadyResult* result);
+
+#endif
@@ -0,0 +1,331 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <time.h>
+#include "sweep.h"
+#include "stats.h"
+#include "thread_pool.h"
+
+// Carga de trabalho partilhada pelas células com os mesmos parâmetros de geração
+typedef struct {
+    DistributionType arrival_dist;
+    DistributionType burst_dist;
+    int process_count;
+    SimTime max_time;
+    int seed;
+
+    pthread_mutex_t lock;
+    bool ready;
+    Process** processes;
+    int count;
+    atomic_int users;          // Células que ainda vão usar a carga
+} SweepWorkload;
+
+typedef struct {
+    SweepWorkload* workload;
+    SchedulerType type;
+    int quantum;
+} SweepCell;
+
+typedef struct {
+    FILE* output;
+    pthread_mutex_t output_lock;
+} SweepOutput;
+
+typedef struct {
+    SweepCell cell;
+    SweepOutput* output;
+} SweepTask;
+
+// ---------------- Leitura da especificação ----------------
+
+static void list_append(SweepList* list, int value) {
+    list->values = (int*)realloc(list->values, (list->count + 1) * sizeof(int));
+    if (list->values == NULL) {
+        perror("Erro ao alocar memória para o varrimento");
+        exit(EXIT_FAILURE);
+    }
+    list->values[list->count++] = value;
+}
+
+// Inteiros: "4", "1..64" ou "0..1000:100", todos em [min_value, INT_MAX]
+static bool parse_int_item(const char* item, SweepList* list, int min_value) {
+    char* end;
+    long first = strtol(item, &end, 10);
+    if (end == item) return false;
+    long last = first;
+    long step = 1;
+    if (*end != '\0') {
+        if (strncmp(end, "..", 2) != 0) return false;
+        const char* rest = end + 2;
+        last = strtol(rest, &end, 10);
+        if (end == rest) return false;
+        if (*end == ':') {
+            rest = end + 1;
+            step = strtol(rest, &end, 10);
+            if (end == rest || step <= 0) return false;
+        }
+        if (*end != '\0' || last < first) return false;
+    }
+    if (first < min_value || last > INT_MAX) return false;
+
+    for (long v = first; v <= last; v += step) {
+        list_append(list, (int)v);
+    }
+    return true;
+}
+
+bool parse_sweep_list(const char* text, SweepList* list, int min_value) {
+    char* copy = strdup(text);
+    if (copy == NULL) {
+        perror("Erro ao alocar memória para o varrimento");
+        exit(EXIT_FAILURE);
+    }
+    bool ok = true;
+    char* save;
+    for (char* item = strtok_r(copy, ",", &save); ok && item != NULL; item = strtok_r(NULL, ",", &save)) {
+        ok = parse_int_item(item, list, min_value);
+    }
+    free(copy);
+    return ok && list->count > 0;
+}
+
+static bool parse_item(const char* key, const char* item, SweepSpec* spec) {
+    if (strcmp(key, "algorithms") == 0) {
+        SchedulerType type;
+        if (strcmp(item, "all") == 0) {
+            for (int t = FCFS; t <= HRRN; t++) list_append(&spec->algorithms, t);
+            return true;
+        }
+        if (!scheduler_type_from_name(item, &type)) return false;
+        list_append(&spec->algorithms, type);
+        return true;
+    }
+    if (strcmp(key, "arrival") == 0 || strcmp(key, "burst") == 0) {
+        DistributionType dist;
+        if (!distribution_from_name(item, &dist)) return false;
+        list_append(strcmp(key, "arrival") == 0 ? &spec->arrival_dists : &spec->burst_dists, dist);
+        return true;
+    }
+    // Um quantum < 1 deixaria o Round Robin sem avançar
+    if (strcmp(key, "quantum") == 0) return parse_int_item(item, &spec->quanta, 1);
+    if (strcmp(key, "processes") == 0) return parse_int_item(item, &spec->process_counts, 1);
+    if (strcmp(key, "max_time") == 0) return parse_int_item(item, &spec->max_times, 1);
+    if (strcmp(key, "seeds") == 0) return parse_int_item(item, &spec->seeds, INT_MIN);
+    return false;
+}
+
+bool parse_sweep_spec(const char* text, SweepSpec* spec) {
+    memset(spec, 0, sizeof(*spec));
+    char* copy = strdup(text);
+    if (copy == NULL) {
+        perror("Erro ao alocar memória para o varrimento");
+        exit(EXIT_FAILURE);
+    }
+
+    bool ok = true;
+    char* save_entry;
+    for (char* entry = strtok_r(copy, ";", &save_entry); ok && entry != NULL;
+         entry = strtok_r(NULL, ";", &save_entry)) {
+        char* equals = strchr(entry, '=');
+        if (equals == NULL) {
+            fprintf(stderr, "Varrimento: entrada inválida '%s'\n", entry);
+            ok = false;
+            break;
+        }
+        *equals = '\0';
+
+        char* save_item;
+        for (char* item = strtok_r(equals + 1, ",", &save_item); item != NULL;
+             item = strtok_r(NULL, ",", &save_item)) {
+            if (!parse_item(entry, item, spec)) {
+                fprintf(stderr, "Varrimento: valor inválido '%s' em '%s'\n", item, entry);
+                ok = false;
+                break;
+            }
+        }
+    }
+    free(copy);
+
+    if (!ok) {
+        free_sweep_spec(spec);
+        return false;
+    }
+
+    // Valores por omissão das dimensões não indicadas
+    if (spec->algorithms.count == 0) {
+        for (int t = FCFS; t <= HRRN; t++) list_append(&spec->algorithms, t);
+    }
+    if (spec->quanta.count == 0) list_append(&spec->quanta, 4);
+    if (spec->arrival_dists.count == 0) list_append(&spec->arrival_dists, DIST_EXPONENTIAL);
+    if (spec->burst_dists.count == 0) list_append(&spec->burst_dists, DIST_NORMAL);
+    if (spec->process_counts.count == 0) list_append(&spec->process_counts, 1000);
+    if (spec->max_times.count == 0) list_append(&spec->max_times, 1000000);
+    if (spec->seeds.count == 0) list_append(&spec->seeds, 1);
+    return true;
+}
+
+void free_sweep_spec(SweepSpec* spec) {
+    free(spec->algorithms.values);
+    free(spec->quanta.values);
+    free(spec->arrival_dists.values);
+    free(spec->burst_dists.values);
+    free(spec->process_counts.values);
+    free(spec->max_times.values);
+    free(spec->seeds.values);
+    memset(spec, 0, sizeof(*spec));
+}
+
+// ---------------- Execução ----------------
+
+static void acquire_workload(SweepWorkload* workload) {
+    pthread_mutex_lock(&workload->lock);
+    if (!workload->ready) {
+        workload->processes = (Process**)malloc(workload->process_count * sizeof(Process*));
+        if (workload->processes == NULL) {
+            perror("Erro ao alocar memória para processos");
+            exit(EXIT_FAILURE);
+        }
+        workload->count = generate_processes_parallel(workload->processes, workload->process_count,
+                                                      workload->arrival_dist, workload->burst_dist,
+                                                      workload->max_time,
+                                                      (unsigned long long)workload->seed);
+        workload->ready = true;
+    }
+    pthread_mutex_unlock(&workload->lock);
+}
+
+// A última célula a usar a carga de trabalho liberta-a
+static void release_workload(SweepWorkload* workload) {
+    if (atomic_fetch_sub(&workload->users, 1) == 1) {
+        for (int i = 0; i < workload->count; i++) {
+            free_process(workload->processes[i]);
+        }
+        free(workload->processes);
+        workload->processes = NULL;
+    }
+}
+
+static void run_cell(void* arg) {
+    SweepTask* task = (SweepTask*)arg;
+    SweepCell* cell = &task->cell;
+    SweepWorkload* workload = cell->workload;
+
+    acquire_workload(workload);
+
+    // schedule() reordena e altera os processos: cada célula usa cópias
+    int count = workload->count;
+    Process** processes = (Process**)malloc(count * sizeof(Process*));
+    if (processes == NULL) {
+        perror("Erro ao alocar memória para processos");
+        exit(EXIT_FAILURE);
+    }
+    for (int i = 0; i < count; i++) {
+        processes[i] = clone_process(workload->processes[i]);
+    }
+    release_workload(workload);
+
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    schedule(processes, count, cell->type, cell->quantum, workload->max_time);
+    SimulationStats stats = calculate_stats(processes, count, workload->max_time);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double elapsed_ms = (end.tv_sec - start.tv_sec) * 1e3 + (end.tv_nsec - start.tv_nsec) / 1e6;
+
+    for (int i = 0; i < count; i++) {
+        free_process(processes[i]);
+    }
+    free(processes);
+
+    SweepOutput* output = task->output;
+    pthread_mutex_lock(&output->output_lock);
+    if (cell->type == ROUND_ROBIN) {
+        fprintf(output->output, "%s\t%d", scheduler_type_name(cell->type), cell->quantum);
+    } else {
+        fprintf(output->output, "%s\t-", scheduler_type_name(cell->type));
+    }
+    fprintf(output->output, "\t%s\t%s\t%d\t%lld\t%d\t%d\t%.4f\t%.4f\t%.4f\t%.4f\t%.6f\t%lld\t%.3f\n",
+            distribution_name(workload->arrival_dist), distribution_name(workload->burst_dist),
+            workload->process_count, workload->max_time, workload->seed, count,
+            stats.avg_waiting_time, stats.avg_turnaround_time, stats.avg_response_time,
+            stats.cpu_utilization, stats.throughput, stats.deadline_misses, elapsed_ms);
+    fflush(output->output);
+    pthread_mutex_unlock(&output->output_lock);
+}
+
+int run_sweep(const SweepSpec* spec, int threads, FILE* output) {
+    int workload_count = spec->arrival_dists.count * spec->burst_dists.count *
+                         spec->process_counts.count * spec->max_times.count * spec->seeds.count;
+    int cells_per_workload = 0;
+    for (int a = 0; a < spec->algorithms.count; a++) {
+        cells_per_workload += spec->algorithms.values[a] == ROUND_ROBIN ? spec->quanta.count : 1;
+    }
+    int cell_count = workload_count * cells_per_workload;
+
+    SweepWorkload* workloads = (SweepWorkload*)calloc(workload_count, sizeof(SweepWorkload));
+    SweepTask* tasks = (SweepTask*)malloc(cell_count * sizeof(SweepTask));
+    if (workloads == NULL || tasks == NULL) {
+        perror("Erro ao alocar memória para o varrimento");
+        exit(EXIT_FAILURE);
+    }
+
+    SweepOutput out;
+    out.output = output;
+    pthread_mutex_init(&out.output_lock, NULL);
+
+    // Planeamento: células agrupadas por carga de trabalho
+    int w = 0, c = 0;
+    for (int ai = 0; ai < spec->arrival_dists.count; ai++)
+    for (int bi = 0; bi < spec->burst_dists.count; bi++)
+    for (int ni = 0; ni < spec->process_counts.count; ni++)
+    for (int ti = 0; ti < spec->max_times.count; ti++)
+    for (int si = 0; si < spec->seeds.count; si++) {
+        SweepWorkload* workload = &workloads[w++];
+        workload->arrival_dist = (DistributionType)spec->arrival_dists.values[ai];
+        workload->burst_dist = (DistributionType)spec->burst_dists.values[bi];
+        workload->process_count = spec->process_counts.values[ni];
+        workload->max_time = spec->max_times.values[ti];
+        workload->seed = spec->seeds.values[si];
+        pthread_mutex_init(&workload->lock, NULL);
+        atomic_init(&workload->users, cells_per_workload);
+
+        for (int a = 0; a < spec->algorithms.count; a++) {
+            SchedulerType type = (SchedulerType)spec->algorithms.values[a];
+            int quanta = type == ROUND_ROBIN ? spec->quanta.count : 1;
+            for (int q = 0; q < quanta; q++) {
+                tasks[c].cell.workload = workload;
+                tasks[c].cell.type = type;
+                tasks[c].cell.quantum = spec->quanta.values[q];
+                tasks[c].output = &out;
+                c++;
+            }
+        }
+    }
+
+    fprintf(output, "algorithm\tquantum\tarrival\tburst\tprocesses\tmax_time\tseed\tgenerated"
+                    "\tavg_waiting\tavg_turnaround\tavg_response\tcpu_utilization\tthroughput"
+                    "\tdeadline_misses\telapsed_ms\n");
+    fflush(output);
+
+    bool was_verbose = scheduler_is_verbose();
+    set_scheduler_verbose(false);
+    ThreadPool* pool = thread_pool_create(threads);
+    for (int i = 0; i < cell_count; i++) {
+        thread_pool_submit(pool, run_cell, &tasks[i]);
+    }
+    thread_pool_destroy(pool);
+    set_scheduler_verbose(was_verbose);
+
+    for (int i = 0; i < workload_count; i++) {
+        pthread_mutex_destroy(&workloads[i].lock);
+    }
+    pthread_mutex_destroy(&out.output_lock);
+    free(workloads);
+    free(tasks);
+    return cell_count;
+}
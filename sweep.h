@@ -0,0 +1,52 @@
+// ----------------------------------------------------------------
+//               Varrimento de parâmetros (grelha de cenários)
+
+//   Cada célula da grelha (algoritmo × quantum × distribuições × N ×
+//   tempo máximo × seed) é uma chamada independente a schedule().
+//   As células correm num pool com roubo de tarefas, as cargas de
+//   trabalho são geradas uma vez e partilhadas entre as células com
+//   os mesmos parâmetros de geração, e cada resultado é escrito numa
+//   tabela única assim que a célula termina.
+// ----------------------------------------------------------------
+
+#ifndef SWEEP_H
+#define SWEEP_H
+
+#include <stdio.h>
+#include <stdbool.h>
+#include "process.h"
+#include "scheduler.h"
+
+typedef struct {
+    int* values;
+    int count;
+} SweepList;
+
+typedef struct {
+    SweepList algorithms;      // Valores de SchedulerType
+    SweepList quanta;          // Só usado pelo Round Robin
+    SweepList arrival_dists;   // Valores de DistributionType
+    SweepList burst_dists;
+    SweepList process_counts;
+    SweepList max_times;
+    SweepList seeds;
+} SweepSpec;
+
+// Lê uma especificação do tipo
+//   "algorithms=fcfs,rr;quantum=1..64;arrival=exponential;burst=normal,uniform;
+//    processes=1000,10000;max_time=100000;seeds=1..5"
+// Listas separadas por vírgulas; inteiros aceitam intervalos "a..b" ou "a..b:passo".
+// Dimensões omitidas ficam com um único valor por omissão.
+bool parse_sweep_spec(const char* text, SweepSpec* spec);
+
+void free_sweep_spec(SweepSpec* spec);
+
+// Lê uma lista de inteiros ("1,2,8", "1..64", "0..100:10"), acrescentando a 'list'.
+// Falha se algum valor for menor do que min_value.
+bool parse_sweep_list(const char* text, SweepList* list, int min_value);
+
+// Executa a grelha com o número de threads indicado e escreve uma linha
+// (separada por tabs) por célula em 'output'. Devolve o nº de células.
+int run_sweep(const SweepSpec* spec, int threads, FILE* output);
+
+#endif
@@ -0,0 +1,160 @@
+// ----------------------------------------------------------------
+//      make check: re-simulação incremental contra schedule()
+
+//   Para cada algoritmo e várias cargas aleatórias aplica edições
+//   aleatórias (burst, chegada, prioridade ou burst e chegada) e exige
+//   que incremental_evaluate produza exatamente os mesmos resultados
+//   por processo e as mesmas estatísticas que uma simulação completa
+//   da carga editada.
+// ----------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "process.h"
+#include "scheduler.h"
+#include "incremental.h"
+#include "stats.h"
+
+#define CHECK_PROCESSES 3000
+#define CHECK_EDITS 25
+#define CHECK_MAX_TIME 1000
+
+static unsigned long long rng_state = 88172645463325252ULL;
+
+// xorshift64: a sequência de edições é sempre a mesma
+static unsigned next_random(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return (unsigned)(rng_state >> 11);
+}
+
+static ProcessEdit random_edit(Process** workload, int count) {
+    const Process* target = workload[next_random() % count];
+    ProcessEdit edit = { target->pid, -1, -1, -1 };
+    int kind = next_random() % 4;
+
+    if (kind == 0 || kind == 3) {
+        edit.burst_time = 1 + next_random() % 40;
+    }
+    if (kind == 1 || kind == 3) {
+        SimTime arrival = target->arrival_time + (SimTime)(next_random() % 200) - 100;
+        edit.arrival_time = arrival < 0 ? 0 : arrival;
+    }
+    if (kind == 2) {
+        edit.priority = next_random() % 11;
+    }
+    return edit;
+}
+
+// Cópia da carga com a edição aplicada, pronta para schedule()
+static Process** edited_copy(Process** workload, int count, const ProcessEdit* edit) {
+    Process** copy = (Process**)malloc(count * sizeof(Process*));
+    if (copy == NULL) {
+        perror("Falha ao alocar memória para a carga editada");
+        exit(EXIT_FAILURE);
+    }
+    for (int i = 0; i < count; i++) {
+        copy[i] = clone_process(workload[i]);
+        if (copy[i]->pid == edit->pid) {
+            if (edit->arrival_time != -1) copy[i]->arrival_time = edit->arrival_time;
+            if (edit->burst_time != -1) copy[i]->burst_time = edit->burst_time;
+            if (edit->priority != -1) copy[i]->priority = edit->priority;
+            copy[i]->remaining_time = copy[i]->burst_time;
+        }
+    }
+    return copy;
+}
+
+static bool same_process(const Process* a, const Process* b) {
+    return a->pid == b->pid &&
+           a->completion_time == b->completion_time &&
+           a->first_run_time == b->first_run_time &&
+           a->remaining_time == b->remaining_time &&
+           a->missed_deadline == b->missed_deadline &&
+           a->deadline_miss_count == b->deadline_miss_count;
+}
+
+static bool same_stats(const SimulationStats* a, const SimulationStats* b) {
+    return a->avg_waiting_time == b->avg_waiting_time &&
+           a->avg_turnaround_time == b->avg_turnaround_time &&
+           a->cpu_utilization == b->cpu_utilization &&
+           a->throughput == b->throughput &&
+           a->avg_response_time == b->avg_response_time &&
+           a->deadline_misses == b->deadline_misses;
+}
+
+// Devolve o número de edições cujo resultado difere da simulação completa
+static int check_workload(SchedulerType type, int seed) {
+    Process** workload = (Process**)malloc(CHECK_PROCESSES * sizeof(Process*));
+    if (workload == NULL) {
+        perror("Falha ao alocar memória para a carga");
+        exit(EXIT_FAILURE);
+    }
+    int count = generate_processes_parallel(workload, CHECK_PROCESSES, seed % 4, (seed + 1) % 4,
+                                            1 << 28, seed);
+    int quantum = 1 + seed % 4;
+    IncrementalRun* run = incremental_create(workload, count, type, quantum, CHECK_MAX_TIME, 32);
+    int failures = 0;
+
+    for (int e = 0; e < CHECK_EDITS; e++) {
+        ProcessEdit edit = random_edit(workload, count);
+        SimulationStats incremental_stats;
+        Process** results;
+        IncrementalInfo info;
+
+        if (!incremental_evaluate(run, &edit, &incremental_stats, &results, &info)) {
+            printf("  algoritmo %d, seed %d: edição do pid %d rejeitada\n", type, seed, edit.pid);
+            failures++;
+            continue;
+        }
+
+        Process** full = edited_copy(workload, count, &edit);
+        schedule(full, count, type, quantum, CHECK_MAX_TIME);
+        SimulationStats full_stats = calculate_stats(full, count, CHECK_MAX_TIME);
+
+        int mismatch = -1;
+        for (int i = 0; i < count && mismatch < 0; i++) {
+            if (!same_process(results[i], full[i])) mismatch = i;
+        }
+        if (mismatch >= 0 || !same_stats(&incremental_stats, &full_stats)) {
+            printf("  algoritmo %d, seed %d: edição do pid %d difere", type, seed, edit.pid);
+            if (mismatch >= 0) {
+                printf(" no pid %d (fim %lld/%lld)", full[mismatch]->pid,
+                       (long long)results[mismatch]->completion_time,
+                       (long long)full[mismatch]->completion_time);
+            }
+            printf(" (recomeço em %lld)\n", (long long)info.restart_time);
+            failures++;
+        }
+
+        for (int i = 0; i < count; i++) free_process(full[i]);
+        free(full);
+    }
+
+    incremental_destroy(run);
+    for (int i = 0; i < count; i++) free_process(workload[i]);
+    free(workload);
+    return failures;
+}
+
+int main(void) {
+    set_scheduler_verbose(false);
+    int failures = 0;
+    int checks = 0;
+
+    for (int type = FCFS; type <= HRRN; type++) {
+        int max_aging = (type == PRIORITY_NP || type == PRIORITY_P) ? 3 : 0;
+        for (int aging = 0; aging <= max_aging; aging += 3) {
+            set_priority_aging(aging);
+            for (int seed = 1; seed <= 4; seed++) {
+                failures += check_workload((SchedulerType)type, seed);
+                checks += CHECK_EDITS;
+            }
+        }
+    }
+    set_priority_aging(0);
+
+    printf("incremental: %d de %d edições diferem da simulação completa\n", failures, checks);
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,196 @@
+// ----------------------------------------------------------------
+//      make check: motor online (libprobsched) contra schedule()
+
+//   Cada carga é submetida ao motor por ordem de chegada, em janelas
+//   de tamanho aleatório, e as decisões consumidas com
+//   probsched_next_dispatch têm de reproduzir a simulação em lote:
+//   o mesmo instante de conclusão e de primeira execução por processo,
+//   as mesmas deadlines perdidas e nenhuma fatia sobreposta. Com
+//   CHECK_PROCESSES jobs o motor retira os terminados várias vezes a
+//   meio de cada carga, o que também fica coberto.
+//
+//   O Rate Monotonic fica de fora: o motor recebe cada ativação como
+//   um job, enquanto schedule() gera as ativações a partir do período.
+// ----------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "process.h"
+#include "scheduler.h"
+#include "probsched.h"
+
+#define CHECK_PROCESSES 2000
+#define CHECK_MAX_TIME 1000
+
+static unsigned long long rng_state = 88172645463325252ULL;
+
+// xorshift64: as janelas de avanço são sempre as mesmas
+static unsigned next_random(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return (unsigned)(rng_state >> 11);
+}
+
+static Process** clone_all(Process** workload, int count) {
+    Process** copy = (Process**)malloc(count * sizeof(Process*));
+    if (copy == NULL) {
+        perror("Falha ao alocar memória para a cópia da carga");
+        exit(EXIT_FAILURE);
+    }
+    for (int i = 0; i < count; i++) copy[i] = clone_process(workload[i]);
+    return copy;
+}
+
+static int compare_arrival(const void* a, const void* b) {
+    const Process* pa = *(Process* const*)a;
+    const Process* pb = *(Process* const*)b;
+    if (pa->arrival_time != pb->arrival_time) return pa->arrival_time < pb->arrival_time ? -1 : 1;
+    return pa->pid - pb->pid;
+}
+
+// Resultado de um processo visto pelas decisões do motor (índice = pid)
+typedef struct {
+    SimTime completion_time;
+    SimTime first_run_time;
+    bool missed_deadline;
+} OnlineResult;
+
+// Devolve o número de processos cujo resultado difere de schedule()
+static int check_workload(SchedulerType type, int seed, int aging) {
+    Process** workload = (Process**)malloc(CHECK_PROCESSES * sizeof(Process*));
+    if (workload == NULL) {
+        perror("Falha ao alocar memória para a carga");
+        exit(EXIT_FAILURE);
+    }
+    int count = generate_processes_parallel(workload, CHECK_PROCESSES, seed % 4, (seed + 1) % 4,
+                                            1 << 28, seed);
+    if (type == PRIORITY_NP || type == PRIORITY_P || type == EDF) {
+        for (int i = 0; i < count; i++) {
+            if (i % 3 == 0 || type == EDF) workload[i]->deadline = workload[i]->burst_time * (1 + i % 5);
+        }
+    }
+    int quantum = 2 + seed % 3;
+
+    set_priority_aging(aging);
+    Process** batch = clone_all(workload, count);
+    schedule(batch, count, type, quantum, CHECK_MAX_TIME);
+
+    // Os pids são 1..count
+    OnlineResult* online = (OnlineResult*)malloc((count + 1) * sizeof(OnlineResult));
+    if (online == NULL) {
+        perror("Falha ao alocar memória para os resultados");
+        exit(EXIT_FAILURE);
+    }
+    for (int i = 0; i <= count; i++) {
+        online[i].completion_time = -1;
+        online[i].first_run_time = -1;
+        online[i].missed_deadline = false;
+    }
+
+    qsort(workload, count, sizeof(Process*), compare_arrival);
+    ProbSchedEngine* engine = probsched_create(type, quantum, aging);
+    int failures = 0;
+    int submitted = 0;
+    SimTime horizon = 0;
+    SimTime last_end = -1;
+
+    while (submitted < count || probsched_pending(engine) > 0) {
+        horizon += 1 + next_random() % 200;
+        while (submitted < count && workload[submitted]->arrival_time < horizon) {
+            const Process* p = workload[submitted++];
+            ProbSchedJob job = { p->pid, p->arrival_time, p->burst_time, p->priority,
+                                 p->deadline, p->period };
+            if (!probsched_submit(engine, &job)) {
+                printf("  algoritmo %d, seed %d: job %d rejeitado\n", type, seed, p->pid);
+                failures++;
+            }
+        }
+        probsched_advance_to(engine, horizon);
+
+        ProbSchedDispatch dispatch;
+        while (probsched_next_dispatch(engine, &dispatch)) {
+            OnlineResult* r = &online[dispatch.job_id];
+            if (dispatch.type == PROBSCHED_DEADLINE_MISS) {
+                r->missed_deadline = true;
+                r->completion_time = dispatch.start_time;
+                continue;
+            }
+            if (dispatch.start_time < last_end) {
+                printf("  algoritmo %d, seed %d: fatia do job %d sobreposta em %lld\n",
+                       type, seed, dispatch.job_id, (long long)dispatch.start_time);
+                failures++;
+            }
+            last_end = dispatch.start_time + dispatch.duration;
+            if (r->first_run_time == -1) r->first_run_time = dispatch.start_time;
+            if (dispatch.completed) r->completion_time = last_end;
+        }
+    }
+
+    for (int i = 0; i < count; i++) {
+        const Process* p = batch[i];
+        const OnlineResult* r = &online[p->pid];
+        // Nem todos os algoritmos de schedule() registam a primeira execução
+        bool differs = r->completion_time != p->completion_time ||
+                       r->missed_deadline != p->missed_deadline ||
+                       (p->first_run_time != -1 && !p->missed_deadline &&
+                        r->first_run_time != p->first_run_time);
+        if (differs) {
+            if (failures == 0) {
+                printf("  algoritmo %d, seed %d, aging %d: pid %d termina em %lld/%lld, "
+                       "começa em %lld/%lld\n", type, seed, aging, p->pid,
+                       (long long)r->completion_time, (long long)p->completion_time,
+                       (long long)r->first_run_time, (long long)p->first_run_time);
+            }
+            failures++;
+        }
+    }
+
+    probsched_destroy(engine);
+    free(online);
+    for (int i = 0; i < count; i++) {
+        free_process(batch[i]);
+        free_process(workload[i]);
+    }
+    free(batch);
+    free(workload);
+    return failures;
+}
+
+// EDF: os jobs sem deadline ficam depois de todos os outros, mas executam
+static int check_edf_without_deadline(void) {
+    ProbSchedEngine* engine = probsched_create(EDF, 0, 0);
+    for (int id = 1; id <= 8; id++) {
+        ProbSchedJob job = { id, id, 3, 1, id % 2 == 0 ? 0 : 10, 0 };
+        probsched_submit(engine, &job);
+    }
+    probsched_advance_to(engine, 1000);
+    int pending = probsched_pending(engine);
+    probsched_destroy(engine);
+    if (pending != 0) {
+        printf("  EDF: %d jobs sem deadline nunca executaram\n", pending);
+    }
+    return pending;
+}
+
+int main(void) {
+    set_scheduler_verbose(false);
+    int failures = 0;
+    int checks = 0;
+
+    for (int type = FCFS; type <= HRRN; type++) {
+        if (type == RATE_MONOTONIC) continue;
+        int max_aging = (type == PRIORITY_NP || type == PRIORITY_P) ? 3 : 0;
+        for (int aging = 0; aging <= max_aging; aging += 3) {
+            for (int seed = 1; seed <= 4; seed++) {
+                failures += check_workload((SchedulerType)type, seed, aging);
+                checks++;
+            }
+        }
+    }
+    set_priority_aging(0);
+    failures += check_edf_without_deadline();
+
+    printf("probsched: %d processos diferem da simulação em lote (%d cargas)\n", failures, checks);
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
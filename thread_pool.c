@@ -0,0 +1,224 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include "thread_pool.h"
+#include "parallel.h"
+#include "profile.h"
+
+typedef struct {
+    PoolTask task;
+    void* arg;
+} PoolItem;
+
+// Fila dupla de uma thread: o dono usa o fim (LIFO), os ladrões o início (FIFO)
+typedef struct {
+    pthread_mutex_t lock;
+    PoolItem* items;
+    int head;
+    int tail;
+    int capacity;
+    pthread_t thread;
+    int id;
+    ThreadPool* pool;
+} Worker;
+
+struct ThreadPool {
+    Worker* workers;
+    int worker_count;
+    int next_worker;            // Rotação das submissões externas
+
+    pthread_mutex_t state_lock;
+    pthread_cond_t work_available;
+    pthread_cond_t all_done;
+    int queued;                 // Tarefas nas filas
+    int pending;                // Tarefas submetidas e ainda não terminadas
+    bool shutdown;
+};
+
+static _Thread_local Worker* current_worker = NULL;
+
+static void deque_push(Worker* worker, PoolItem item) {
+    pthread_mutex_lock(&worker->lock);
+    if (worker->tail == worker->capacity) {
+        // Compacta ou cresce o vetor
+        int used = worker->tail - worker->head;
+        if (used * 2 > worker->capacity) {
+            worker->capacity *= 2;
+            worker->items = (PoolItem*)realloc(worker->items, worker->capacity * sizeof(PoolItem));
+            if (worker->items == NULL) {
+                perror("Erro ao realocar fila do pool");
+                exit(EXIT_FAILURE);
+            }
+        }
+        for (int i = 0; i < used; i++) {
+            worker->items[i] = worker->items[worker->head + i];
+        }
+        worker->head = 0;
+        worker->tail = used;
+    }
+    worker->items[worker->tail++] = item;
+    pthread_mutex_unlock(&worker->lock);
+}
+
+static bool deque_pop_bottom(Worker* worker, PoolItem* item) {
+    bool found = false;
+    pthread_mutex_lock(&worker->lock);
+    if (worker->tail > worker->head) {
+        *item = worker->items[--worker->tail];
+        found = true;
+    }
+    pthread_mutex_unlock(&worker->lock);
+    return found;
+}
+
+static bool deque_steal_top(Worker* worker, PoolItem* item) {
+    bool found = false;
+    pthread_mutex_lock(&worker->lock);
+    if (worker->tail > worker->head) {
+        *item = worker->items[worker->head++];
+        found = true;
+    }
+    pthread_mutex_unlock(&worker->lock);
+    return found;
+}
+
+static bool take_task(Worker* self, PoolItem* item) {
+    ThreadPool* pool = self->pool;
+    bool found = deque_pop_bottom(self, item);
+
+    // Sem trabalho próprio: tenta roubar às outras threads, a começar pela seguinte
+    for (int k = 1; !found && k < pool->worker_count; k++) {
+        found = deque_steal_top(&pool->workers[(self->id + k) % pool->worker_count], item);
+    }
+
+    if (found) {
+        pthread_mutex_lock(&pool->state_lock);
+        pool->queued--;
+        pthread_mutex_unlock(&pool->state_lock);
+    }
+    return found;
+}
+
+static void* worker_main(void* arg) {
+    Worker* self = (Worker*)arg;
+    ThreadPool* pool = self->pool;
+    current_worker = self;
+    parallel_worker_begin();     // As tarefas não abrem mais threads
+
+    while (1) {
+        PoolItem item;
+        if (take_task(self, &item)) {
+            item.task(item.arg);
+            profile_flush_thread();     // Visíveis quando a espera terminar
+
+            pthread_mutex_lock(&pool->state_lock);
+            if (--pool->pending == 0) {
+                pthread_cond_broadcast(&pool->all_done);
+            }
+            pthread_mutex_unlock(&pool->state_lock);
+            continue;
+        }
+
+        pthread_mutex_lock(&pool->state_lock);
+        while (pool->queued == 0 && !pool->shutdown) {
+            pthread_cond_wait(&pool->work_available, &pool->state_lock);
+        }
+        bool stop = pool->shutdown && pool->queued == 0;
+        pthread_mutex_unlock(&pool->state_lock);
+        if (stop) break;
+    }
+    parallel_worker_end();
+    return NULL;
+}
+
+ThreadPool* thread_pool_create(int threads) {
+    if (threads < 1) threads = 1;
+
+    ThreadPool* pool = (ThreadPool*)calloc(1, sizeof(ThreadPool));
+    Worker* workers = (Worker*)calloc(threads, sizeof(Worker));
+    if (pool == NULL || workers == NULL) {
+        perror("Erro ao alocar memória para o pool de threads");
+        exit(EXIT_FAILURE);
+    }
+    pool->workers = workers;
+    pool->worker_count = threads;
+    pthread_mutex_init(&pool->state_lock, NULL);
+    pthread_cond_init(&pool->work_available, NULL);
+    pthread_cond_init(&pool->all_done, NULL);
+
+    for (int i = 0; i < threads; i++) {
+        Worker* worker = &workers[i];
+        pthread_mutex_init(&worker->lock, NULL);
+        worker->capacity = 64;
+        worker->items = (PoolItem*)malloc(worker->capacity * sizeof(PoolItem));
+        if (worker->items == NULL) {
+            perror("Erro ao alocar fila do pool");
+            exit(EXIT_FAILURE);
+        }
+        worker->id = i;
+        worker->pool = pool;
+    }
+    for (int i = 0; i < threads; i++) {
+        if (pthread_create(&workers[i].thread, NULL, worker_main, &workers[i]) != 0) {
+            perror("Erro ao criar thread do pool");
+            exit(EXIT_FAILURE);
+        }
+    }
+    return pool;
+}
+
+void thread_pool_submit(ThreadPool* pool, PoolTask task, void* arg) {
+    PoolItem item = { task, arg };
+    Worker* target;
+
+    if (current_worker != NULL && current_worker->pool == pool) {
+        target = current_worker;
+    } else {
+        pthread_mutex_lock(&pool->state_lock);
+        target = &pool->workers[pool->next_worker];
+        pool->next_worker = (pool->next_worker + 1) % pool->worker_count;
+        pthread_mutex_unlock(&pool->state_lock);
+    }
+
+    // Conta a tarefa como pendente antes de ficar visível aos ladrões
+    pthread_mutex_lock(&pool->state_lock);
+    pool->pending++;
+    pthread_mutex_unlock(&pool->state_lock);
+
+    deque_push(target, item);
+
+    pthread_mutex_lock(&pool->state_lock);
+    pool->queued++;
+    pthread_cond_signal(&pool->work_available);
+    pthread_mutex_unlock(&pool->state_lock);
+}
+
+void thread_pool_wait(ThreadPool* pool) {
+    pthread_mutex_lock(&pool->state_lock);
+    while (pool->pending > 0) {
+        pthread_cond_wait(&pool->all_done, &pool->state_lock);
+    }
+    pthread_mutex_unlock(&pool->state_lock);
+}
+
+void thread_pool_destroy(ThreadPool* pool) {
+    if (pool == NULL) return;
+    thread_pool_wait(pool);
+
+    pthread_mutex_lock(&pool->state_lock);
+    pool->shutdown = true;
+    pthread_cond_broadcast(&pool->work_available);
+    pthread_mutex_unlock(&pool->state_lock);
+
+    for (int i = 0; i < pool->worker_count; i++) {
+        pthread_join(pool->workers[i].thread, NULL);
+        pthread_mutex_destroy(&pool->workers[i].lock);
+        free(pool->workers[i].items);
+    }
+    pthread_mutex_destroy(&pool->state_lock);
+    pthread_cond_destroy(&pool->work_available);
+    pthread_cond_destroy(&pool->all_done);
+    free(pool->workers);
+    free(pool);
+}
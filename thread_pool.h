@@ -0,0 +1,30 @@
+// ----------------------------------------------------------------
+//            Pool de threads com roubo de tarefas (work stealing)
+
+//   Cada thread tem a sua própria fila: executa as tarefas mais
+//   recentes da sua fila e, quando fica sem trabalho, rouba as mais
+//   antigas das filas das outras threads. Indicado para tarefas
+//   independentes de custo muito desigual.
+// ----------------------------------------------------------------
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+typedef struct ThreadPool ThreadPool;
+
+typedef void (*PoolTask)(void* arg);
+
+// Cria o pool com o número de threads indicado (mínimo 1)
+ThreadPool* thread_pool_create(int threads);
+
+// Submete uma tarefa. Fora do pool as tarefas são distribuídas pelas filas
+// em rotação; dentro de uma tarefa vão para a fila da própria thread.
+void thread_pool_submit(ThreadPool* pool, PoolTask task, void* arg);
+
+// Espera que todas as tarefas submetidas terminem
+void thread_pool_wait(ThreadPool* pool);
+
+// Espera pelas tarefas pendentes, termina as threads e liberta o pool
+void thread_pool_destroy(ThreadPool* pool);
+
+#endif